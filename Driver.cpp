@@ -7,17 +7,30 @@
 
 #include "./ut/inc/unit_test.hpp"
 #include "./sorting_benchmark/inc/benchmark.hpp"
+#include "./container_benchmark/inc/container_benchmark.hpp"
 
-int main() {
+int main(int argc, char *argv[]) {
 
     experimental_vector_unit_tests();
+    experimental_small_vector_unit_tests();
+    experimental_mmap_vector_unit_tests();
+    experimental_segmented_vector_unit_tests();
     experimental_sorting_algorithms_unit_tests();
+    experimental_simd_algorithms_unit_tests();
     experimental_stack_unit_test();
     experimental_list_unit_tests();
+    experimental_unrolled_list_unit_tests();
+    experimental_intrusive_list_unit_tests();
+    experimental_mpmc_queue_unit_tests();
+    experimental_spsc_queue_unit_tests();
+    experimental_concurrent_stack_unit_tests();
     experimental_BST_unit_tests();
     experimental_AVL_unit_tests();
+    experimental_concurrent_skip_list_unit_tests();
 
-    benchmark_sorting_algorithms();
+    if (!benchmark_containers(argc, argv)) {
+        benchmark_sorting_algorithms(argc, argv);
+    }
 
     return EXIT_SUCCESS;
 }
\ No newline at end of file
@@ -0,0 +1,82 @@
+/*
+ *	File name:	"concurrent_stack_benchmark.cpp"
+ *	Date:		10/19/2026 11:34:08 AM
+ *	Author:		Vo, Dinh Tue Minh
+ *	Purpose:	Compare the lock-free ConcurrentStack with a Stack guarded by a mutex under contention
+ */
+
+#include "./inc/container_benchmark.hpp"
+#include "../inc/ds/experimental_stack.hpp"
+#include "../inc/ds/experimental_concurrent_stack.hpp"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace experimental;
+
+namespace {
+	constexpr int ITEMS = 1 << 20;
+
+	// the shared stack that ConcurrentStack replaces
+	class LockedStack {
+	public:
+		void push(int item) {
+			std::lock_guard<std::mutex> lock(mutex_);
+			stack_.push(item);
+		}
+
+		bool try_pop(int &item) {
+			std::lock_guard<std::mutex> lock(mutex_);
+			if (stack_.empty()) {
+				return false;
+			}
+			item = stack_.top();
+			stack_.pop();
+			return true;
+		}
+
+	private:
+		std::mutex mutex_;
+		Stack<int> stack_;
+	};
+
+	// get the millions of push-pop pairs per second on 'stack' with 'threads' threads,
+	// each thread pushing then popping its share of ITEMS items, so pushes and pops collide on the head
+	template<typename SharedStack>
+	double million_pairs_per_second(SharedStack &stack, int threads) {
+		auto start = std::chrono::high_resolution_clock::now();
+		std::vector<std::thread> workers;
+		for (int t = 0; t < threads; ++t) {
+			workers.emplace_back([&stack, t, threads]() {
+				int item;
+				for (int i = t; i < ITEMS; i += threads) {
+					stack.push(i);
+					stack.try_pop(item);
+				}
+			});
+		}
+		for (auto &worker : workers) {
+			worker.join();
+		}
+		auto stop = std::chrono::high_resolution_clock::now();
+		return ITEMS / std::chrono::duration<double, std::micro>(stop - start).count();
+	}
+}
+
+void benchmark_concurrent_stack() {
+	std::cout << "Millions of push-pop pairs per second on a stack shared by every thread ("
+		<< std::thread::hardware_concurrency() << " hardware threads):\n"
+		<< std::setw(8) << "threads" << std::setw(17) << "mutex + Stack" << std::setw(18) << "ConcurrentStack" << '\n';
+	std::cout << std::fixed << std::setprecision(2);
+	for (int threads : { 1, 2, 4, 8, 16, 32, 64 }) {
+		LockedStack locked;
+		ConcurrentStack<int> lockFree;
+		std::cout << std::setw(8) << threads << std::setw(17) << million_pairs_per_second(locked, threads)
+			<< std::setw(18) << million_pairs_per_second(lockFree, threads) << '\n';
+	}
+	std::cout.unsetf(std::ios::fixed);
+}
@@ -0,0 +1,89 @@
+/*
+ *	File name:	"container_benchmark.cpp"
+ *	Date:		10/18/2026 9:10:32 PM
+ *	Author:		Vo, Dinh Tue Minh
+ *	Purpose:	Select and run the container benchmarks
+ */
+
+#include "./inc/container_benchmark.hpp"
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+	struct ContainerBenchmark {
+		char const *name;
+		char const *description;
+		void (*run)();
+	};
+
+	// the benchmarks in the order they run
+	ContainerBenchmark const CONTAINER_BENCHMARKS[] = {
+		{ "small_vector", "allocations and latency of short Vector vs SmallVector", benchmark_small_vector },
+		{ "simd", "vectorized find/count/minmax/accumulate/equal and branchless lower_bound vs naive loops", benchmark_simd_algorithms },
+		{ "list_pool", "queue, build/clear and traversal of List with the default allocator vs PoolAllocator", benchmark_list_pool },
+		{ "unrolled_list", "scans and insertions in the middle of List vs UnrolledList vs Vector", benchmark_unrolled_list },
+		{ "mpmc_queue", "lock-free MPMC queues vs a List guarded by a mutex, 1 to 64 threads", benchmark_mpmc_queue },
+		{ "spsc_queue", "SPSC ring buffer between two threads, one element or one batch at a time, vs BoundedMPMCQueue", benchmark_spsc_queue },
+		{ "concurrent_stack", "lock-free ConcurrentStack vs a Stack guarded by a mutex, 1 to 64 threads", benchmark_concurrent_stack },
+		{ "skip_list", "ConcurrentSkipList vs an AVLTree guarded by a mutex, read-heavy and write-heavy, 1 to 64 threads", benchmark_skip_list },
+	};
+
+	void print_usage(char const *program) {
+		std::cout << "Usage: " << program << " --bench=<names>\n"
+			<< "\t--bench=all\t\t\trun every container benchmark\n";
+		for (auto const &benchmark : CONTAINER_BENCHMARKS) {
+			std::cout << "\t--bench=" << benchmark.name << "\t\t" << benchmark.description << '\n';
+		}
+	}
+}
+
+bool benchmark_containers(int argc, char const *const *argv) {
+	bool found = false;
+	for (int i = 1; i < argc; ++i) {
+		found = found || std::string(argv[i]).compare(0, 8, "--bench=") == 0;
+	}
+	if (!found) {
+		return false;
+	}
+
+	std::vector<std::string> names;
+	for (int i = 1; i < argc; ++i) {
+		std::string arg = argv[i];
+		if (arg.compare(0, 8, "--bench=") != 0) {
+			std::cout << "Unknown option: " << arg << '\n';
+			print_usage(argv[0]);
+			return true;
+		}
+		std::istringstream iss(arg.substr(8));
+		for (std::string name; std::getline(iss, name, ',');) {
+			if (!name.empty()) {
+				names.push_back(name);
+			}
+		}
+	}
+
+	for (auto const &name : names) {
+		bool known = name == "all";
+		for (auto const &benchmark : CONTAINER_BENCHMARKS) {
+			known = known || name == benchmark.name;
+		}
+		if (!known) {
+			std::cout << "Unknown container benchmark: " << name << '\n';
+			print_usage(argv[0]);
+			return true;
+		}
+	}
+
+	for (auto const &benchmark : CONTAINER_BENCHMARKS) {
+		for (auto const &name : names) {
+			if (name == "all" || name == benchmark.name) {
+				benchmark.run();
+				break;
+			}
+		}
+	}
+	return true;
+}
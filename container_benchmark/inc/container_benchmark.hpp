@@ -0,0 +1,44 @@
+/*
+ *	File name:	"container_benchmark.hpp"
+ *	Date:		10/18/2026 9:07:15 PM
+ *	Author:		Vo, Dinh Tue Minh
+ *	Purpose:	Declaration for benchmarking the containers
+ */
+
+#pragma once
+
+#ifndef _CONTAINER_BENCHMARK_HPP_
+#define _CONTAINER_BENCHMARK_HPP_
+
+/*	Run the container benchmarks selected on the command line
+ *		--bench=small_vector	names of the benchmarks, "all" runs every one
+ *
+ *	Return: false if there is no --bench option, so that the sorting benchmark runs instead
+ */
+bool benchmark_containers(int argc, char const *const *argv);
+
+// allocation count and latency of short Vector vs SmallVector
+void benchmark_small_vector();
+
+// vectorized search and reduction algorithms vs naive loops
+void benchmark_simd_algorithms();
+
+// List with the default allocator vs PoolAllocator
+void benchmark_list_pool();
+
+// scans and insertions in the middle of List vs UnrolledList vs Vector
+void benchmark_unrolled_list();
+
+// lock-free MPMC queues vs a List guarded by a mutex, 1 to 64 threads
+void benchmark_mpmc_queue();
+
+// SPSC ring buffer between two threads, single elements and batches, vs BoundedMPMCQueue
+void benchmark_spsc_queue();
+
+// lock-free ConcurrentStack vs a Stack guarded by a mutex, 1 to 64 threads
+void benchmark_concurrent_stack();
+
+// ConcurrentSkipList vs an AVLTree guarded by a mutex, read-heavy and write-heavy, 1 to 64 threads
+void benchmark_skip_list();
+
+#endif // !_CONTAINER_BENCHMARK_HPP_
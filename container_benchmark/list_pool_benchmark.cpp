@@ -0,0 +1,130 @@
+/*
+ *	File name:	"list_pool_benchmark.cpp"
+ *	Date:		10/19/2026 4:12:08 AM
+ *	Author:		Vo, Dinh Tue Minh
+ *	Purpose:	Compare List with the default allocator and with PoolAllocator
+ */
+
+#include "./inc/container_benchmark.hpp"
+#include "../inc/ds/experimental_list.hpp"
+#include "../inc/experimental_allocators.hpp"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+using namespace experimental;
+
+namespace {
+	constexpr int OPERATIONS = 1 << 22;
+
+	volatile long long sink;
+
+	// get the nanoseconds per operation of running 'work', which does 'operations' operations
+	template<typename Work>
+	double ns_per_operation(long long operations, Work work) {
+		auto start = std::chrono::high_resolution_clock::now();
+		sink = work();
+		auto stop = std::chrono::high_resolution_clock::now();
+		return std::chrono::duration<double, std::nano>(stop - start).count() / static_cast<double>(operations);
+	}
+
+	// push_back and pop_front on a list of 'n' elements, as a queue
+	template<typename L>
+	double queue_churn(int n) {
+		L l;
+		for (int i = 0; i < n; ++i) {
+			l.push_back(i);
+		}
+		return ns_per_operation(OPERATIONS, [&]() {
+			long long total = 0;
+			for (int i = 0; i < OPERATIONS; ++i) {
+				total += l.front();
+				l.pop_front();
+				l.push_back(i);
+			}
+			return total;
+		});
+	}
+
+	// build lists of 'n' elements then clear them
+	template<typename L>
+	double build_clear(int n) {
+		L l;
+		int const rounds = OPERATIONS / n;
+		return ns_per_operation(static_cast<long long>(rounds) * n, [&]() {
+			long long total = 0;
+			for (int round = 0; round < rounds; ++round) {
+				for (int i = 0; i < n; ++i) {
+					l.push_back(i);
+				}
+				total += l.size();
+				l.clear();
+			}
+			return total;
+		});
+	}
+
+	// traverse a list of 'n' elements which had every other element replaced,
+	// so that the nodes of the default allocator are scattered
+	template<typename L>
+	double traversal(int n) {
+		L l;
+		for (int i = 0; i < n; ++i) {
+			l.push_back(i);
+		}
+		for (auto it = l.begin(); it != l.end();) {
+			it = l.erase(it);
+			l.insert(it, -1);
+			if (it != l.end()) {
+				++it;
+			}
+		}
+		int const rounds = OPERATIONS / n;
+		return ns_per_operation(static_cast<long long>(rounds) * n, [&]() {
+			long long total = 0;
+			for (int round = 0; round < rounds; ++round) {
+				for (int value : l) {
+					total += value;
+				}
+			}
+			return total;
+		});
+	}
+
+	template<template<typename> class Workload>
+	void print_row(char const *workload, int n) {
+		double standard = Workload<List<int>>::run(n);
+		double pooled = Workload<List<int, PoolAllocator<int>>>::run(n);
+		std::cout << std::setw(14) << workload << std::setw(10) << n
+			<< std::setw(12) << standard << std::setw(12) << pooled << std::setw(10) << standard / pooled << '\n';
+	}
+
+	template<typename L>
+	struct QueueChurn {
+		static double run(int n) { return queue_churn<L>(n); }
+	};
+
+	template<typename L>
+	struct BuildClear {
+		static double run(int n) { return build_clear<L>(n); }
+	};
+
+	template<typename L>
+	struct Traversal {
+		static double run(int n) { return traversal<L>(n); }
+	};
+}
+
+void benchmark_list_pool() {
+	std::cout << "Nanoseconds per element of List<int> with the default allocator and with PoolAllocator:\n"
+		<< std::setw(14) << "workload" << std::setw(10) << "n"
+		<< std::setw(12) << "default" << std::setw(12) << "pool" << std::setw(10) << "speedup" << '\n';
+	std::cout << std::fixed << std::setprecision(2);
+	for (int n : { 1 << 8, 1 << 14, 1 << 20 }) {
+		print_row<QueueChurn>("queue", n);
+		print_row<BuildClear>("build+clear", n);
+		print_row<Traversal>("traversal", n);
+	}
+	std::cout.unsetf(std::ios::fixed);
+}
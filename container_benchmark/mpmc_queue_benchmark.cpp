@@ -0,0 +1,113 @@
+/*
+ *	File name:	"mpmc_queue_benchmark.cpp"
+ *	Date:		10/19/2026 10:05:52 AM
+ *	Author:		Vo, Dinh Tue Minh
+ *	Purpose:	Compare the lock-free MPMC queues with a List guarded by a mutex under contention
+ */
+
+#include "./inc/container_benchmark.hpp"
+#include "../inc/ds/experimental_list.hpp"
+#include "../inc/ds/experimental_mpmc_queue.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace experimental;
+
+namespace {
+	constexpr int ITEMS = 1 << 20;
+	constexpr alias::size_type BOUNDED_CAPACITY = 1024;
+
+	// the work queue that the lock-free queues replace
+	class LockedList {
+	public:
+		void push(int item) {
+			std::lock_guard<std::mutex> lock(mutex_);
+			list_.push_back(item);
+		}
+
+		bool try_pop(int &item) {
+			std::lock_guard<std::mutex> lock(mutex_);
+			if (list_.empty()) {
+				return false;
+			}
+			item = list_.front();
+			list_.pop_front();
+			return true;
+		}
+
+	private:
+		std::mutex mutex_;
+		List<int> list_;
+	};
+
+	// get the millions of items per second going through 'queue' with 'threads' threads:
+	// half of them push ITEMS items altogether and the other half pop them,
+	// a single thread pushes and pops in turn
+	template<typename Queue>
+	double million_items_per_second(Queue &queue, int threads) {
+		auto start = std::chrono::high_resolution_clock::now();
+		if (threads == 1) {
+			int item;
+			for (int i = 0; i < ITEMS; ++i) {
+				queue.push(i);
+				queue.try_pop(item);
+			}
+		}
+		else {
+			int producers = threads / 2;
+			int consumers = threads - producers;
+			std::atomic<int> popped{ 0 };
+			std::vector<std::thread> workers;
+			for (int p = 0; p < producers; ++p) {
+				workers.emplace_back([&queue, p, producers]() {
+					for (int i = p; i < ITEMS; i += producers) {
+						queue.push(i);
+					}
+				});
+			}
+			for (int c = 0; c < consumers; ++c) {
+				workers.emplace_back([&queue, &popped]() {
+					int item;
+					Backoff backoff;
+					while (popped.load(std::memory_order_relaxed) < ITEMS) {
+						if (queue.try_pop(item)) {
+							popped.fetch_add(1, std::memory_order_relaxed);
+							backoff.reset();
+						}
+						else {
+							backoff.pause();
+						}
+					}
+				});
+			}
+			for (auto &worker : workers) {
+				worker.join();
+			}
+		}
+		auto stop = std::chrono::high_resolution_clock::now();
+		return ITEMS / std::chrono::duration<double, std::micro>(stop - start).count();
+	}
+}
+
+void benchmark_mpmc_queue() {
+	std::cout << "Millions of ints per second through a queue, half of the threads pushing and half popping ("
+		<< std::thread::hardware_concurrency() << " hardware threads):\n"
+		<< std::setw(8) << "threads" << std::setw(16) << "mutex + List" << std::setw(18) << "BoundedMPMCQueue"
+		<< std::setw(12) << "MPMCQueue" << '\n';
+	std::cout << std::fixed << std::setprecision(2);
+	for (int threads : { 1, 2, 4, 8, 16, 32, 64 }) {
+		LockedList locked;
+		BoundedMPMCQueue<int> bounded(BOUNDED_CAPACITY);
+		MPMCQueue<int> unbounded;
+		std::cout << std::setw(8) << threads << std::setw(16) << million_items_per_second(locked, threads)
+			<< std::setw(18) << million_items_per_second(bounded, threads)
+			<< std::setw(12) << million_items_per_second(unbounded, threads) << '\n';
+	}
+	std::cout.unsetf(std::ios::fixed);
+}
@@ -0,0 +1,190 @@
+/*
+ *	File name:	"simd_algorithms_benchmark.cpp"
+ *	Date:		10/19/2026 2:57:30 AM
+ *	Author:		Vo, Dinh Tue Minh
+ *	Purpose:	Compare the vectorized algorithms with the naive loops
+ */
+
+#include "./inc/container_benchmark.hpp"
+#include "../inc/experimental_simd_algorithms.hpp"
+#include "../inc/ds/experimental_vector.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+using namespace experimental;
+
+namespace {
+	// elements scanned per measurement, so that small inputs are repeated
+	constexpr alias::size_type ELEMENTS_PER_MEASUREMENT = 1ULL << 26;
+	constexpr int QUERIES = 1 << 20;
+
+	volatile long long sink;
+
+	// get the nanoseconds per element of running 'scan' over 'n' elements
+	template<typename Scan>
+	double ns_per_element(alias::size_type n, Scan scan) {
+		alias::size_type rounds = std::max<alias::size_type>(1, ELEMENTS_PER_MEASUREMENT / n);
+		long long result = 0;
+		auto start = std::chrono::high_resolution_clock::now();
+		for (alias::size_type round = 0; round < rounds; ++round) {
+			result += static_cast<long long>(scan());
+		}
+		auto stop = std::chrono::high_resolution_clock::now();
+		sink = result;
+		return std::chrono::duration<double, std::nano>(stop - start).count() / static_cast<double>(rounds * n);
+	}
+
+	/* Naive loops */
+	// ===============================================================================
+	template<typename T>
+	alias::size_type naive_find(Vector<T> const &v, T value) {
+		alias::size_type i = 0;
+		while (i < v.size() && v[i] != value) {
+			++i;
+		}
+		return i;
+	}
+
+	template<typename T>
+	alias::size_type naive_count(Vector<T> const &v, T value) {
+		alias::size_type total = 0;
+		for (alias::size_type i = 0; i < v.size(); ++i) {
+			total += v[i] == value;
+		}
+		return total;
+	}
+
+	template<typename T>
+	T naive_min_max(Vector<T> const &v) {
+		T low = v[0], high = v[0];
+		for (alias::size_type i = 1; i < v.size(); ++i) {
+			if (v[i] < low) {
+				low = v[i];
+			}
+			if (high < v[i]) {
+				high = v[i];
+			}
+		}
+		return high - low;
+	}
+
+	template<typename T>
+	T naive_accumulate(Vector<T> const &v) {
+		T total{};
+		for (alias::size_type i = 0; i < v.size(); ++i) {
+			total += v[i];
+		}
+		return total;
+	}
+
+	template<typename T>
+	bool naive_equal(Vector<T> const &a, Vector<T> const &b) {
+		for (alias::size_type i = 0; i < a.size(); ++i) {
+			if (a[i] != b[i]) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	// print the nanoseconds per element of the naive loop then of each instruction set
+	template<typename Naive, typename Vectorized>
+	void print_row(char const *algorithm, char const *type, alias::size_type n, Naive naive, Vectorized vectorized) {
+		std::cout << std::setw(16) << algorithm << std::setw(7) << type << std::setw(11) << n
+			<< std::setw(10) << ns_per_element(n, naive);
+		for (auto level : { simd::SimdLevel::SCALAR, simd::SimdLevel::SSE4, simd::SimdLevel::AVX2 }) {
+			simd::set_simd_level(level);
+			if (simd::simd_level() == level) {
+				std::cout << std::setw(10) << ns_per_element(n, vectorized);
+			}
+			else {
+				std::cout << std::setw(10) << "-";
+			}
+		}
+		simd::set_simd_level(simd::supported_simd_level());
+		std::cout << '\n';
+	}
+
+	template<typename T>
+	void benchmark_scans(char const *type, alias::size_type n) {
+		std::mt19937 gen(7);
+		Vector<T> v;
+		v.reserve(n);
+		for (alias::size_type i = 0; i < n; ++i) {
+			v.push_back(static_cast<T>(gen() % 1000000));
+		}
+		Vector<T> copy = v;
+		T const absent = static_cast<T>(-1);		// scan the whole input
+
+		print_row("find", type, n,
+				  [&]() { return naive_find(v, absent); },
+				  [&]() { return simd::find(v, absent) == v.end(); });
+		print_row("count", type, n,
+				  [&]() { return naive_count(v, v[n / 2]); },
+				  [&]() { return simd::count(v, v[n / 2]); });
+		print_row("minmax_element", type, n,
+				  [&]() { return naive_min_max(v); },
+				  [&]() { auto extremes = simd::minmax_element(v); return *extremes.second - *extremes.first; });
+		print_row("accumulate", type, n,
+				  [&]() { return naive_accumulate(v); },
+				  [&]() { return simd::accumulate(v, T{}); });
+		print_row("equal", type, n,
+				  [&]() { return naive_equal(v, copy); },
+				  [&]() { return simd::equal(v, copy); });
+	}
+
+	// print the nanoseconds per query of std::lower_bound and of the branchless lower_bound
+	void benchmark_lower_bound(alias::size_type n) {
+		std::mt19937 gen(11);
+		Vector<int> v;
+		v.reserve(n);
+		for (alias::size_type i = 0; i < n; ++i) {
+			v.push_back(static_cast<int>(gen() % (4 * n)));
+		}
+		std::sort(v.begin(), v.end());
+		Vector<int> queries;
+		for (int i = 0; i < QUERIES; ++i) {
+			queries.push_back(static_cast<int>(gen() % (4 * n)));
+		}
+		int const *first = v.data();
+		int const *last = v.data() + v.size();
+
+		auto time_queries = [&](auto search) {
+			long long result = 0;
+			auto start = std::chrono::high_resolution_clock::now();
+			for (int i = 0; i < QUERIES; ++i) {
+				result += search(queries[i]) - first;
+			}
+			auto stop = std::chrono::high_resolution_clock::now();
+			sink = result;
+			return std::chrono::duration<double, std::nano>(stop - start).count() / QUERIES;
+		};
+		double standard = time_queries([&](int value) { return std::lower_bound(first, last, value); });
+		double branchless = time_queries([&](int value) { return simd::lower_bound(first, last, value); });
+		std::cout << std::setw(11) << n << std::setw(18) << standard << std::setw(14) << branchless << '\n';
+	}
+}
+
+void benchmark_simd_algorithms() {
+	std::cout << "Nanoseconds per element of the naive loop over a Vector and of the algorithms\n"
+		<< "of experimental_simd_algorithms.hpp with each instruction set (- if unsupported):\n"
+		<< std::setw(16) << "algorithm" << std::setw(7) << "type" << std::setw(11) << "n"
+		<< std::setw(10) << "naive" << std::setw(10) << "scalar" << std::setw(10) << "SSE4" << std::setw(10) << "AVX2" << '\n';
+	std::cout << std::fixed << std::setprecision(3);
+	for (alias::size_type n : { 1ULL << 12, 1ULL << 18, 1ULL << 24 }) {
+		benchmark_scans<int>("int", n);
+		benchmark_scans<float>("float", n);
+	}
+
+	std::cout << "\nNanoseconds per query of lower_bound on a sorted Vector<int>:\n"
+		<< std::setw(11) << "n" << std::setw(18) << "std::lower_bound" << std::setw(14) << "branchless" << '\n';
+	std::cout << std::setprecision(1);
+	for (alias::size_type n : { 1ULL << 10, 1ULL << 16, 1ULL << 22 }) {
+		benchmark_lower_bound(n);
+	}
+	std::cout.unsetf(std::ios::fixed);
+}
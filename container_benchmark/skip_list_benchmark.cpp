@@ -0,0 +1,107 @@
+/*
+ *	File name:	"skip_list_benchmark.cpp"
+ *	Date:		10/19/2026 4:41:30 PM
+ *	Author:		Vo, Dinh Tue Minh
+ *	Purpose:	Compare the ConcurrentSkipList with an AVLTree guarded by a mutex, on read-heavy and write-heavy loads
+ */
+
+#include "./inc/container_benchmark.hpp"
+#include "../inc/ds/experimental_avl_tree.hpp"
+#include "../inc/ds/experimental_concurrent_skip_list.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace experimental;
+
+namespace {
+	constexpr int KEYS = 1 << 16;
+	constexpr int OPERATIONS = 1 << 20;
+
+	// the shared ordered set that ConcurrentSkipList replaces
+	class LockedAVLTree {
+	public:
+		void insert(int value) {
+			std::lock_guard<std::mutex> lock(mutex_);
+			tree_.insert(value);
+		}
+
+		void remove(int value) {
+			std::lock_guard<std::mutex> lock(mutex_);
+			tree_.remove(value);
+		}
+
+		bool contains(int value) {
+			std::lock_guard<std::mutex> lock(mutex_);
+			return tree_.contains(value);
+		}
+
+	private:
+		std::mutex mutex_;
+		AVLTree<int> tree_;
+	};
+
+	// get the millions of operations per second on 'set' with 'threads' threads sharing OPERATIONS operations
+	// on random keys of [0, KEYS): 'readPercent' % of contains, and as many inserts as removes for the rest
+	// the set starts with half of the keys
+	template<typename Set>
+	double million_operations_per_second(Set &set, int threads, unsigned readPercent) {
+		for (int key = 0; key < KEYS; key += 2) {
+			set.insert(key);
+		}
+		auto start = std::chrono::high_resolution_clock::now();
+		std::vector<std::thread> workers;
+		for (int t = 0; t < threads; ++t) {
+			workers.emplace_back([&set, t, threads, readPercent]() {
+				std::uint32_t seed = 2654435761u * (t + 1);
+				int found = 0;
+				for (int i = t; i < OPERATIONS; i += threads) {
+					seed ^= seed << 13;
+					seed ^= seed >> 17;
+					seed ^= seed << 5;
+					int key = static_cast<int>(seed % KEYS);
+					unsigned kind = (seed >> 16) % 100;
+					if (kind < readPercent) {
+						found += set.contains(key);
+					}
+					else if (kind % 2 == 0) {
+						set.insert(key);
+					}
+					else {
+						set.remove(key);
+					}
+				}
+				if (found < 0) {
+					std::cout << found;
+				}
+			});
+		}
+		for (auto &worker : workers) {
+			worker.join();
+		}
+		auto stop = std::chrono::high_resolution_clock::now();
+		return OPERATIONS / std::chrono::duration<double, std::micro>(stop - start).count();
+	}
+}
+
+void benchmark_skip_list() {
+	std::cout << "Millions of operations per second on an ordered set of " << KEYS << " keys shared by every thread ("
+		<< std::thread::hardware_concurrency() << " hardware threads):\n";
+	std::cout << std::fixed << std::setprecision(2);
+	for (unsigned readPercent : { 90u, 0u }) {
+		std::cout << (readPercent ? "read-heavy: 90% contains, 5% insert, 5% remove\n" : "write-heavy: 50% insert, 50% remove\n")
+			<< std::setw(8) << "threads" << std::setw(17) << "mutex + AVLTree" << std::setw(21) << "ConcurrentSkipList" << '\n';
+		for (int threads : { 1, 2, 4, 8, 16, 32, 64 }) {
+			LockedAVLTree locked;
+			ConcurrentSkipList<int> skipList;
+			std::cout << std::setw(8) << threads << std::setw(17) << million_operations_per_second(locked, threads, readPercent)
+				<< std::setw(21) << million_operations_per_second(skipList, threads, readPercent) << '\n';
+		}
+	}
+	std::cout.unsetf(std::ios::fixed);
+}
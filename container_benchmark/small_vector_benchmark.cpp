@@ -0,0 +1,91 @@
+/*
+ *	File name:	"small_vector_benchmark.cpp"
+ *	Date:		10/18/2026 9:24:09 PM
+ *	Author:		Vo, Dinh Tue Minh
+ *	Purpose:	Compare the allocations and the latency of short Vector and SmallVector
+ */
+
+#include "./inc/container_benchmark.hpp"
+#include "../sorting_benchmark/inc/allocation_tracker.hpp"
+#include "../inc/ds/experimental_small_vector.hpp"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+
+using namespace experimental;
+
+namespace {
+	constexpr int ROUNDS = 1000000;
+	constexpr alias::size_type INLINE_CAPACITY = 16;
+
+	// keeps the sums observable so the loops are not optimized away
+	volatile long long sink;
+
+	// measurements of building ROUNDS vectors
+	struct ShortVectorResult {
+		double nanoseconds;		// per vector
+		double allocations;		// per vector
+	};
+
+	// build, read and destroy a vector of 'length' ints, return the sum of its elements
+	template<typename VectorType>
+	long long build_short_vector(int round, int length) {
+		VectorType v;
+		for (int i = 0; i < length; ++i) {
+			v.push_back(round + i);
+		}
+		long long sum = 0;
+		for (auto it = v.begin(), end = v.end(); it != end; ++it) {
+			sum += *it;
+		}
+		return sum;
+	}
+
+	// build, read and destroy ROUNDS vectors of 'length' ints
+	// the allocations are counted in a second pass so that the tracking does not slow the timed one,
+	// std::allocator goes through the global operator new, which the allocation tracker counts
+	template<typename VectorType>
+	ShortVectorResult build_short_vectors(int length) {
+		long long sum = 0;
+		auto start = std::chrono::high_resolution_clock::now();
+		for (int round = 0; round < ROUNDS; ++round) {
+			sum += build_short_vector<VectorType>(round, length);
+		}
+		auto stop = std::chrono::high_resolution_clock::now();
+
+		set_allocation_tracking(true);
+		long long allocationsBefore = allocation_stats().allocations;
+		for (int round = 0; round < ROUNDS; ++round) {
+			sum += build_short_vector<VectorType>(round, length);
+		}
+		long long allocations = allocation_stats().allocations - allocationsBefore;
+		set_allocation_tracking(false);
+		sink = sum;
+
+		return { std::chrono::duration<double, std::nano>(stop - start).count() / ROUNDS,
+				 static_cast<double>(allocations) / ROUNDS };
+	}
+}
+
+void benchmark_small_vector() {
+	using PlainVector = Vector<int, std::allocator<int>>;
+	using ShortVector = SmallVector<int, INLINE_CAPACITY, std::allocator<int>>;
+
+	std::cout << "Build " << ROUNDS << " vectors of n ints with push_back, read and destroy them\n"
+		<< "Vector<int> vs SmallVector<int, " << INLINE_CAPACITY << ">, per vector:\n"
+		<< std::setw(6) << "n"
+		<< std::setw(14) << "Vector ns" << std::setw(10) << "allocs"
+		<< std::setw(18) << "SmallVector ns" << std::setw(10) << "allocs" << '\n';
+
+	std::cout << std::fixed << std::setprecision(1);
+	for (int length : { 1, 2, 4, 8, 16, 32, 64 }) {
+		ShortVectorResult plain = build_short_vectors<PlainVector>(length);
+		ShortVectorResult small = build_short_vectors<ShortVector>(length);
+		std::cout << std::setw(6) << length
+			<< std::setw(14) << plain.nanoseconds << std::setw(10) << plain.allocations
+			<< std::setw(18) << small.nanoseconds << std::setw(10) << small.allocations << '\n';
+	}
+	std::cout.unsetf(std::ios::fixed);
+}
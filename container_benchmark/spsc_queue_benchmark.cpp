@@ -0,0 +1,103 @@
+/*
+ *	File name:	"spsc_queue_benchmark.cpp"
+ *	Date:		10/19/2026 2:20:14 PM
+ *	Author:		Vo, Dinh Tue Minh
+ *	Purpose:	Measure the throughput of the SPSC ring buffer between two threads, one element or one batch at a time
+ */
+
+#include "./inc/container_benchmark.hpp"
+#include "../inc/ds/experimental_mpmc_queue.hpp"
+#include "../inc/ds/experimental_spsc_queue.hpp"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace experimental;
+
+namespace {
+	constexpr int ITEMS = 1 << 24;
+	constexpr alias::size_type CAPACITY = 1 << 12;
+
+	// get the millions of ints per second that a producer thread passes to a consumer thread,
+	// one at a time, through 'queue'
+	template<typename Queue>
+	double million_items_per_second(Queue &queue) {
+		auto start = std::chrono::high_resolution_clock::now();
+		std::thread producer([&queue]() {
+			for (int i = 0; i < ITEMS; ++i) {
+				queue.push(i);
+			}
+		});
+		long long sum = 0;
+		for (int i = 0; i < ITEMS; ++i) {
+			sum += queue.pop();
+		}
+		producer.join();
+		auto stop = std::chrono::high_resolution_clock::now();
+		if (sum != static_cast<long long>(ITEMS) * (ITEMS - 1) / 2) {
+			std::cout << "wrong sum\n";
+		}
+		return ITEMS / std::chrono::duration<double, std::micro>(stop - start).count();
+	}
+
+	// same through push_n() and pop_n() with batches of 'batch' ints, a divisor of ITEMS
+	double million_items_per_second_batched(SPSCQueue<int> &queue, int batch) {
+		auto start = std::chrono::high_resolution_clock::now();
+		std::thread producer([&queue, batch]() {
+			std::vector<int> items(batch);
+			for (int next = 0; next < ITEMS; next += batch) {
+				for (int i = 0; i < batch; ++i) {
+					items[i] = next + i;
+				}
+				alias::size_type pushed = 0;
+				for (Backoff backoff; pushed < items.size(); backoff.pause()) {
+					pushed += queue.push_n(items.data() + pushed, items.size() - pushed);
+				}
+			}
+		});
+		std::vector<int> items(batch);
+		long long sum = 0;
+		Backoff backoff;
+		for (int popped = 0; popped < ITEMS;) {
+			auto count = static_cast<int>(queue.pop_n(items.data(), items.size()));
+			if (count == 0) {
+				backoff.pause();
+				continue;
+			}
+			backoff.reset();
+			for (int i = 0; i < count; ++i) {
+				sum += items[i];
+			}
+			popped += count;
+		}
+		producer.join();
+		auto stop = std::chrono::high_resolution_clock::now();
+		if (sum != static_cast<long long>(ITEMS) * (ITEMS - 1) / 2) {
+			std::cout << "wrong sum\n";
+		}
+		return ITEMS / std::chrono::duration<double, std::micro>(stop - start).count();
+	}
+}
+
+void benchmark_spsc_queue() {
+	std::cout << "Millions of ints per second from a producer thread to a consumer thread, capacity " << CAPACITY
+		<< " (" << std::thread::hardware_concurrency() << " hardware threads):\n";
+	std::cout << std::fixed << std::setprecision(2);
+	{
+		BoundedMPMCQueue<int> queue(CAPACITY);
+		std::cout << std::setw(28) << "BoundedMPMCQueue push/pop" << std::setw(10) << million_items_per_second(queue) << '\n';
+	}
+	{
+		SPSCQueue<int> queue(CAPACITY);
+		std::cout << std::setw(28) << "SPSCQueue push/pop" << std::setw(10) << million_items_per_second(queue) << '\n';
+	}
+	for (int batch : { 16, 256 }) {
+		SPSCQueue<int> queue(CAPACITY);
+		std::cout << std::setw(28) << "SPSCQueue batch of " + std::to_string(batch) << std::setw(10) << million_items_per_second_batched(queue, batch) << '\n';
+	}
+	std::cout.unsetf(std::ios::fixed);
+}
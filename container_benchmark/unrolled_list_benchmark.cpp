@@ -0,0 +1,88 @@
+/*
+ *	File name:	"unrolled_list_benchmark.cpp"
+ *	Date:		10/19/2026 6:10:44 AM
+ *	Author:		Vo, Dinh Tue Minh
+ *	Purpose:	Compare the scans and the insertions in the middle of List, UnrolledList and Vector
+ */
+
+#include "./inc/container_benchmark.hpp"
+#include "../inc/ds/experimental_list.hpp"
+#include "../inc/ds/experimental_unrolled_list.hpp"
+#include "../inc/ds/experimental_vector.hpp"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+using namespace experimental;
+
+namespace {
+	constexpr long long ELEMENTS_PER_MEASUREMENT = 1LL << 26;
+	constexpr int INSERTIONS = 1 << 12;
+
+	volatile long long sink;
+
+	template<typename Work>
+	double elapsed_ns(Work work) {
+		auto start = std::chrono::high_resolution_clock::now();
+		sink = work();
+		auto stop = std::chrono::high_resolution_clock::now();
+		return std::chrono::duration<double, std::nano>(stop - start).count();
+	}
+
+	// get the nanoseconds per element of summing a container of 'n' elements
+	template<typename C>
+	double scan(int n) {
+		C c;
+		for (int i = 0; i < n; ++i) {
+			c.push_back(i);
+		}
+		long long const rounds = ELEMENTS_PER_MEASUREMENT / n;
+		return elapsed_ns([&]() {
+			long long total = 0;
+			for (long long round = 0; round < rounds; ++round) {
+				for (int value : c) {
+					total += value;
+				}
+			}
+			return total;
+		}) / static_cast<double>(rounds * n);
+	}
+
+	// get the nanoseconds per insertion in the middle of a container of 'n' elements,
+	// given an iterator to the middle
+	template<typename C>
+	double insert_middle(int n) {
+		C c;
+		for (int i = 0; i < n; ++i) {
+			c.push_back(i);
+		}
+		auto it = c.begin();
+		for (int i = 0; i < n / 2; ++i) {
+			++it;
+		}
+		return elapsed_ns([&]() {
+			for (int i = 0; i < INSERTIONS; ++i) {
+				it = c.insert(it, i);
+			}
+			return static_cast<long long>(c.size());
+		}) / INSERTIONS;
+	}
+}
+
+void benchmark_unrolled_list() {
+	std::cout << "Nanoseconds per element of a scan, and per insertion in the middle, of List<int>, UnrolledList<int>\n"
+		<< "(" << UnrolledList<int>::BLOCK_SIZE << " elements per block) and Vector<int>:\n"
+		<< std::setw(10) << "n" << std::setw(12) << "workload"
+		<< std::setw(10) << "List" << std::setw(14) << "UnrolledList" << std::setw(10) << "Vector" << '\n';
+	std::cout << std::fixed << std::setprecision(2);
+	for (int n : { 1 << 10, 1 << 16, 1 << 22 }) {
+		std::cout << std::setw(10) << n << std::setw(12) << "scan"
+			<< std::setw(10) << scan<List<int>>(n) << std::setw(14) << scan<UnrolledList<int>>(n)
+			<< std::setw(10) << scan<Vector<int>>(n) << '\n';
+		std::cout << std::setw(10) << n << std::setw(12) << "insert"
+			<< std::setw(10) << insert_middle<List<int>>(n) << std::setw(14) << insert_middle<UnrolledList<int>>(n)
+			<< std::setw(10) << insert_middle<Vector<int>>(n) << '\n';
+	}
+	std::cout.unsetf(std::ios::fixed);
+}
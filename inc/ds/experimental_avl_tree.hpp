@@ -14,6 +14,7 @@
 #include "../experimental_alias_declarations.hpp"
 
 #include <functional>
+#include <iostream>
 
 namespace experimental {
 
@@ -0,0 +1,380 @@
+/*
+ *	File name:	"experimental_concurrent_skip_list.hpp"
+ *	Date:		10/19/2026 3:04:51 PM
+ *	Author:		Vo, Dinh Tue Minh
+ *	Purpose:	Implementation of an ordered set shared by threads:
+ *				lazy skip list with wait-free searches, per-node locks and epoch-based reclamation
+ */
+
+#pragma once
+
+#ifndef _EXPERIMENTAL_CONCURRENT_SKIP_LIST_HPP_
+#define _EXPERIMENTAL_CONCURRENT_SKIP_LIST_HPP_
+
+#include "../experimental_alias_declarations.hpp"
+#include "../experimental_concurrency.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <new>
+#include <utility>
+
+namespace experimental {
+	/*	ConcurrentSkipList ADT class
+		provides an ordered set shared by any number of threads, an alternative to a locked AVLTree
+		(M. Herlihy, Y. Lev, V. Luchangco and N. Shavit's lazy skip list).
+		Each node is linked in levels 0 to height - 1, level 0 holds every element in order
+		and each level above skips about half of the level below, so a search takes O(log n) steps.
+		- contains() and the traversals take no lock: they only follow the links.
+		- insert() and remove() lock the nodes preceding the element at each of its levels,
+		  then check that those nodes are still linked to the same successors before changing the links,
+		  so operations on distant elements do not wait for each other.
+		- An element is in the set once it is linked at every level, and leaves it when it is marked,
+		  before it is unlinked.
+		- Unlinked nodes are retired to the epoch-based reclamation, so a traversal never reads freed memory.
+		The order is determined by Comparator object, as in AVLTree.
+		Note:
+		- for_each() sees the elements present during the whole traversal, and may or may not see
+		  the elements inserted or removed meanwhile.
+	*/
+	template<typename T, typename Comparator = std::less<T>>
+	class ConcurrentSkipList {
+	public:
+		using value_type = T;
+		using reference = value_type &;
+		using const_reference = value_type const &;
+		using size_type = alias::size_type;
+
+		/* The Big-Five */
+		// ===============================================================================
+
+		~ConcurrentSkipList() {
+			Node *p = head_.next_[0].load(std::memory_order_relaxed);
+			while (p) {
+				Node *next = p->next_[0].load(std::memory_order_relaxed);
+				delete p;
+				p = next;
+			}
+		}
+
+		ConcurrentSkipList()
+			: ConcurrentSkipList(Comparator{}) {}
+
+		explicit ConcurrentSkipList(Comparator const &cmp)
+			: cmp_{ cmp } {}
+
+		ConcurrentSkipList(ConcurrentSkipList const &) = delete;
+		ConcurrentSkipList& operator=(ConcurrentSkipList const &) = delete;
+
+		/* Capacity operations */
+		// ===============================================================================
+
+		// query if the set is empty, exact when no thread modifies the set
+		bool empty() const {
+			EpochGuard guard;
+			bool found = false;
+			for_each_from(head(), [&found](const_reference) { found = true; return false; });
+			return !found;
+		}
+
+		/* Modifying operations */
+		// ===============================================================================
+
+		// insert 'value' into the set
+		// return false if the value already exists
+		bool insert(const_reference value) {
+			return insert_node(create_node(random_height(), value));
+		}
+		bool insert(value_type &&value) {
+			return insert_node(create_node(random_height(), std::move(value)));
+		}
+
+		// remove 'value' from the set
+		// return false if the value does not exist
+		bool remove(const_reference value) {
+			NodeBase *preds[MAX_HEIGHT];
+			Node *succs[MAX_HEIGHT];
+			Node *victim = nullptr;
+			EpochGuard guard;
+			for (Backoff backoff;; backoff.pause()) {
+				int levelFound = find(value, preds, succs);
+				if (!victim) {
+					// only remove an element linked at every level, and not being removed
+					if (levelFound < 0) {
+						return false;
+					}
+					Node *node = succs[levelFound];
+					if (!node->fullyLinked_.load(std::memory_order_acquire) || node->height_ != levelFound + 1
+						|| node->marked_.load(std::memory_order_acquire)) {
+						return false;
+					}
+					node->lock();
+					if (node->marked_.load(std::memory_order_relaxed)) {
+						node->unlock();
+						return false;
+					}
+					// the element leaves the set here
+					node->marked_.store(true, std::memory_order_release);
+					victim = node;
+				}
+				int locked;
+				bool valid = lock_predecessors(preds, victim->height_, [victim](NodeBase *pred, int level) {
+					return !pred->marked_.load(std::memory_order_relaxed)
+						&& pred->next_[level].load(std::memory_order_relaxed) == victim;
+				}, locked);
+				if (!valid) {
+					unlock_predecessors(preds, locked);
+					continue;
+				}
+				for (int level = victim->height_ - 1; level >= 0; --level) {
+					preds[level]->next_[level].store(victim->next_[level].load(std::memory_order_relaxed), std::memory_order_release);
+				}
+				victim->unlock();
+				unlock_predecessors(preds, locked);
+				retire(victim);
+				return true;
+			}
+		}
+
+		/* Search operations */
+		// ===============================================================================
+
+		// query if the 'value' exists in the set
+		bool contains(const_reference value) const {
+			EpochGuard guard;
+			NodeBase *pred = head();
+			for (int level = MAX_HEIGHT - 1; level >= 0; --level) {
+				Node *curr = pred->next_[level].load(std::memory_order_acquire);
+				while (curr && cmp_(curr->value_, value)) {
+					pred = curr;
+					curr = curr->next_[level].load(std::memory_order_acquire);
+				}
+				if (curr && !cmp_(value, curr->value_)) {
+					return curr->fullyLinked_.load(std::memory_order_acquire) && !curr->marked_.load(std::memory_order_acquire);
+				}
+			}
+			return false;
+		}
+
+		/* Traversal operations */
+		// ===============================================================================
+
+		// call 'f' with every element in order
+		// 'f' runs while the thread is pinned: it should not block
+		template<typename Function>
+		void for_each(Function f) const {
+			EpochGuard guard;
+			for_each_from(head(), [&f](const_reference value) { f(value); return true; });
+		}
+
+		// call 'f' with every element in ['first', 'last') in order
+		template<typename Function>
+		void for_each(const_reference first, const_reference last, Function f) const {
+			EpochGuard guard;
+			NodeBase *pred = head();
+			for (int level = MAX_HEIGHT - 1; level >= 0; --level) {
+				Node *curr = pred->next_[level].load(std::memory_order_acquire);
+				while (curr && cmp_(curr->value_, first)) {
+					pred = curr;
+					curr = curr->next_[level].load(std::memory_order_acquire);
+				}
+			}
+			for_each_from(pred, [this, &f, &last](const_reference value) {
+				if (!cmp_(value, last)) {
+					return false;
+				}
+				f(value);
+				return true;
+			});
+		}
+
+	private:
+		struct Node;
+		using Link = std::atomic<Node *>;
+
+		// the links, lock and state of a node, shared by the head which has no value
+		struct NodeBase {
+			Link *const next_;
+			int const height_;
+			std::atomic<bool> locked_{ false };
+			std::atomic<bool> marked_{ false };			// removed from the set, being unlinked
+			std::atomic<bool> fullyLinked_{ false };	// linked at every level, in the set
+
+			NodeBase(Link *next, int height) noexcept
+				: next_{ next }, height_{ height } {
+				for (int level = 0; level < height; ++level) {
+					::new (static_cast<void *>(next + level)) Link(nullptr);
+				}
+			}
+
+			void lock() noexcept {
+				for (Backoff backoff; locked_.exchange(true, std::memory_order_acquire);) {
+					while (locked_.load(std::memory_order_relaxed)) {
+						backoff.pause();
+					}
+				}
+			}
+
+			void unlock() noexcept {
+				locked_.store(false, std::memory_order_release);
+			}
+		};
+
+		// the links of a node follow it in the same allocation
+		struct Node : NodeBase {
+			value_type value_;
+
+			template<typename... Args>
+			explicit Node(int height, Args &&...args)
+				: NodeBase(reinterpret_cast<Link *>(this + 1), height), value_(std::forward<Args>(args)...) {}
+
+			// free the allocation of create_node(), for 'delete' and retire()
+			static void operator delete(void *p) noexcept {
+				::operator delete(p);
+			}
+		};
+
+		static_assert(alignof(Node) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__, "over-aligned values are not supported");
+
+		// with one level in two promoted, 32 levels index 2^32 elements
+		static constexpr int MAX_HEIGHT = 32;
+
+		Link headLinks_[MAX_HEIGHT];
+		NodeBase head_{ headLinks_, MAX_HEIGHT };
+		Comparator cmp_;
+
+		NodeBase* head() const noexcept {
+			return const_cast<NodeBase *>(&head_);
+		}
+
+		template<typename... Args>
+		static Node* create_node(int height, Args &&...args) {
+			void *p = ::operator new(sizeof(Node) + height * sizeof(Link));
+			try {
+				return ::new (p) Node(height, std::forward<Args>(args)...);
+			}
+			catch (...) {
+				::operator delete(p);
+				throw;
+			}
+		}
+
+		// get a height of 1 with probability 1/2, 2 with probability 1/4, ...
+		static int random_height() noexcept {
+			static thread_local std::uint32_t seed = static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(&seed)) | 1;
+			seed ^= seed << 13;
+			seed ^= seed >> 17;
+			seed ^= seed << 5;
+			int height = 1;
+			for (std::uint32_t bits = seed; (bits & 1) && height < MAX_HEIGHT; bits >>= 1) {
+				++height;
+			}
+			return height;
+		}
+
+		// find the last node before 'value' and the node after it at every level
+		// return the highest level where the node after is 'value', -1 if 'value' is not linked
+		int find(const_reference value, NodeBase **preds, Node **succs) const {
+			int levelFound = -1;
+			NodeBase *pred = head();
+			for (int level = MAX_HEIGHT - 1; level >= 0; --level) {
+				Node *curr = pred->next_[level].load(std::memory_order_acquire);
+				while (curr && cmp_(curr->value_, value)) {
+					pred = curr;
+					curr = curr->next_[level].load(std::memory_order_acquire);
+				}
+				if (levelFound < 0 && curr && !cmp_(value, curr->value_)) {
+					levelFound = level;
+				}
+				preds[level] = pred;
+				succs[level] = curr;
+			}
+			return levelFound;
+		}
+
+		// lock the predecessors of levels 0 to 'height' - 1, from the bottom up, while 'valid' holds for them
+		// return false if 'valid' fails, 'locked' is the number of levels locked anyway
+		// the bottom-up order locks the greater nodes first in every thread, so threads do not deadlock
+		template<typename Predicate>
+		static bool lock_predecessors(NodeBase **preds, int height, Predicate valid, int &locked) noexcept {
+			for (locked = 0; locked < height; ++locked) {
+				if (locked == 0 || preds[locked] != preds[locked - 1]) {
+					preds[locked]->lock();
+				}
+				if (!valid(preds[locked], locked)) {
+					++locked;
+					return false;
+				}
+			}
+			return true;
+		}
+
+		static void unlock_predecessors(NodeBase **preds, int locked) noexcept {
+			for (int level = 0; level < locked; ++level) {
+				if (level + 1 == locked || preds[level] != preds[level + 1]) {
+					preds[level]->unlock();
+				}
+			}
+		}
+
+		// link 'node' at every level, or delete it if its value exists
+		bool insert_node(Node *node) {
+			NodeBase *preds[MAX_HEIGHT];
+			Node *succs[MAX_HEIGHT];
+			EpochGuard guard;
+			for (Backoff backoff;; backoff.pause()) {
+				int levelFound = find(node->value_, preds, succs);
+				if (levelFound >= 0) {
+					Node *found = succs[levelFound];
+					if (!found->marked_.load(std::memory_order_acquire)) {
+						// the value exists, or will once its insertion completes
+						while (!found->fullyLinked_.load(std::memory_order_acquire)) {
+							backoff.pause();
+						}
+						delete node;
+						return false;
+					}
+					// wait for the removal of the marked node to unlink it
+					continue;
+				}
+				int locked;
+				bool valid = lock_predecessors(preds, node->height_, [&succs](NodeBase *pred, int level) {
+					Node *succ = succs[level];
+					return !pred->marked_.load(std::memory_order_relaxed)
+						&& (!succ || !succ->marked_.load(std::memory_order_relaxed))
+						&& pred->next_[level].load(std::memory_order_relaxed) == succ;
+				}, locked);
+				if (!valid) {
+					unlock_predecessors(preds, locked);
+					continue;
+				}
+				for (int level = 0; level < node->height_; ++level) {
+					node->next_[level].store(succs[level], std::memory_order_relaxed);
+				}
+				for (int level = 0; level < node->height_; ++level) {
+					preds[level]->next_[level].store(node, std::memory_order_release);
+				}
+				// the element enters the set here
+				node->fullyLinked_.store(true, std::memory_order_release);
+				unlock_predecessors(preds, locked);
+				return true;
+			}
+		}
+
+		// call 'visit' with the elements after 'pred' in order, until it returns false
+		// the calling thread must be pinned
+		template<typename Visitor>
+		static void for_each_from(NodeBase *pred, Visitor visit) {
+			for (Node *curr = pred->next_[0].load(std::memory_order_acquire); curr;
+				curr = curr->next_[0].load(std::memory_order_acquire)) {
+				if (curr->fullyLinked_.load(std::memory_order_acquire) && !curr->marked_.load(std::memory_order_acquire)
+					&& !visit(curr->value_)) {
+					return;
+				}
+			}
+		}
+	};
+}
+
+#endif // !_EXPERIMENTAL_CONCURRENT_SKIP_LIST_HPP_
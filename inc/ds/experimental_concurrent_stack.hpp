@@ -0,0 +1,205 @@
+/*
+ *	File name:	"experimental_concurrent_stack.hpp"
+ *	Date:		10/19/2026 10:52:19 AM
+ *	Author:		Vo, Dinh Tue Minh
+ *	Purpose:	Implementation of a lock-free stack ADT:
+ *				Treiber stack with tagged head, epoch-based reclamation and elimination backoff
+ */
+
+#pragma once
+
+#ifndef _EXPERIMENTAL_CONCURRENT_STACK_HPP_
+#define _EXPERIMENTAL_CONCURRENT_STACK_HPP_
+
+#include "../experimental_alias_declarations.hpp"
+#include "../experimental_concurrency.hpp"
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <utility>
+
+namespace experimental {
+	/*	ConcurrentStack ADT class
+		provides a lock-free LIFO stack shared by any number of threads (R. K. Treiber's stack):
+		push and pop swing the head with a compare-and-swap.
+		- The head is a tagged pointer: the upper 16 bits count the changes of the head,
+		  so a compare-and-swap fails if the head was popped and pushed back in between (ABA).
+		- Popped nodes are retired to the epoch-based reclamation, so a thread reading the head node
+		  never reads freed memory.
+		- Under contention, a push and a pop whose compare-and-swap failed meet in an elimination array:
+		  the pop takes the node of the push without touching the head, and the two cancel out.
+		Note:
+		- The tag needs pointers of at most 48 significant bits, as the user-space addresses of x86-64 and AArch64.
+	*/
+	template<typename T>
+	class ConcurrentStack {
+	public:
+		using value_type = T;
+		using size_type = alias::size_type;
+
+		/* The Big-Five */
+		// ===============================================================================
+
+		~ConcurrentStack() {
+			Node *p = pointer_of(head_.load(std::memory_order_relaxed));
+			while (p) {
+				Node *next = p->next_;
+				delete p;
+				p = next;
+			}
+		}
+
+		ConcurrentStack() = default;
+
+		ConcurrentStack(ConcurrentStack const &) = delete;
+		ConcurrentStack& operator=(ConcurrentStack const &) = delete;
+
+		/* Modifying operations */
+		// ===============================================================================
+
+		// construct an element from 'args' on the top of the stack
+		template<typename... Args>
+		void emplace(Args &&...args) {
+			Node *node = new Node(std::forward<Args>(args)...);
+			assert((reinterpret_cast<std::uintptr_t>(node) >> POINTER_BITS) == 0 && "pointer too wide for the tag");
+
+			EpochGuard guard;
+			TaggedPointer head = head_.load(std::memory_order_relaxed);
+			for (;;) {
+				node->next_ = pointer_of(head);
+				if (head_.compare_exchange_weak(head, tag(node, head), std::memory_order_release, std::memory_order_relaxed)) {
+					return;
+				}
+				if (offer(node)) {
+					return;
+				}
+				head = head_.load(std::memory_order_relaxed);
+			}
+		}
+		void push(T const &item) {
+			emplace(item);
+		}
+		void push(T &&item) {
+			emplace(std::move(item));
+		}
+
+		// move the top element to 'item' and remove it
+		// return false if the stack is empty
+		bool try_pop(T &item) {
+			EpochGuard guard;
+			TaggedPointer head = head_.load(std::memory_order_acquire);
+			for (;;) {
+				Node *node = pointer_of(head);
+				if (!node) {
+					return false;
+				}
+				// the node is not freed while the thread is pinned, even if another thread pops it
+				if (head_.compare_exchange_weak(head, tag(node->next_, head), std::memory_order_acquire, std::memory_order_acquire)) {
+					take(node, item);
+					return true;
+				}
+				if (Node *eliminated = accept()) {
+					take(eliminated, item);
+					return true;
+				}
+				head = head_.load(std::memory_order_acquire);
+			}
+		}
+
+		// remove the top element, wait while the stack is empty
+		T pop() {
+			T item;
+			for (Backoff backoff; !try_pop(item); backoff.pause());
+			return item;
+		}
+
+		// check if the stack is empty, exact when no thread uses the stack
+		bool empty() const noexcept {
+			return pointer_of(head_.load(std::memory_order_acquire)) == nullptr;
+		}
+
+	private:
+		using TaggedPointer = std::uint64_t;
+
+		struct Node {
+			T value_;
+			Node *next_ = nullptr;
+
+			template<typename... Args>
+			explicit Node(Args &&...args)
+				: value_(std::forward<Args>(args)...) {}
+		};
+
+		// a slot where a push offers its node to a pop
+		struct alignas(CACHE_LINE_SIZE) EliminationSlot {
+			std::atomic<Node *> node_{ nullptr };
+		};
+
+		static constexpr unsigned POINTER_BITS = 48;
+		static constexpr TaggedPointer POINTER_MASK = (TaggedPointer{ 1 } << POINTER_BITS) - 1;
+		static constexpr unsigned ELIMINATION_SLOTS = 8;
+		// pauses for which a push waits for a pop in the elimination array
+		static constexpr unsigned ELIMINATION_WAIT = 128;
+
+		static_assert(sizeof(void *) == sizeof(TaggedPointer), "tagged pointers need 64-bit pointers");
+
+		alignas(CACHE_LINE_SIZE) std::atomic<TaggedPointer> head_{ 0 };
+		EliminationSlot slots_[ELIMINATION_SLOTS];
+
+		static Node* pointer_of(TaggedPointer p) noexcept {
+			return reinterpret_cast<Node *>(p & POINTER_MASK);
+		}
+
+		// tag 'p' with the next count of 'previous'
+		static TaggedPointer tag(Node *p, TaggedPointer previous) noexcept {
+			return ((previous & ~POINTER_MASK) + (TaggedPointer{ 1 } << POINTER_BITS)) | reinterpret_cast<TaggedPointer>(p);
+		}
+
+		static void take(Node *node, T &item) {
+			item = std::move(node->value_);
+			retire(node);
+		}
+
+		// get a slot of the elimination array, spread over the threads
+		EliminationSlot& random_slot() noexcept {
+			static thread_local std::uint32_t seed = static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(&seed));
+			seed ^= seed << 13;
+			seed ^= seed >> 17;
+			seed ^= seed << 5;
+			return slots_[seed % ELIMINATION_SLOTS];
+		}
+
+		// offer 'node' to a pop for a while
+		// return true if a pop took it
+		bool offer(Node *node) noexcept {
+			EliminationSlot &slot = random_slot();
+			Node *empty = nullptr;
+			if (!slot.node_.compare_exchange_strong(empty, node, std::memory_order_release, std::memory_order_relaxed)) {
+				return false;
+			}
+			for (unsigned i = 0; i < ELIMINATION_WAIT; ++i) {
+				if (slot.node_.load(std::memory_order_relaxed) != node) {
+					return true;
+				}
+				details::cpu_relax();
+			}
+			// withdraw the offer, unless a pop took it meanwhile
+			Node *offered = node;
+			return !slot.node_.compare_exchange_strong(offered, nullptr, std::memory_order_relaxed);
+		}
+
+		// take the node offered by a push, if any
+		// the offered nodes are not reused while the thread is pinned, so their addresses identify them
+		Node* accept() noexcept {
+			EliminationSlot &slot = random_slot();
+			Node *node = slot.node_.load(std::memory_order_acquire);
+			if (node && slot.node_.compare_exchange_strong(node, nullptr, std::memory_order_acquire, std::memory_order_relaxed)) {
+				return node;
+			}
+			return nullptr;
+		}
+	};
+}
+
+#endif // !_EXPERIMENTAL_CONCURRENT_STACK_HPP_
@@ -0,0 +1,491 @@
+/*
+ *	File name:	"experimental_intrusive_list.hpp"
+ *	Date:		10/19/2026 6:42:05 AM
+ *	Author:		Vo, Dinh Tue Minh
+ *	Purpose:	Implementation of intrusive list ADT:
+ *				a doubly linked list whose links are embedded in the elements
+ */
+
+#pragma once
+
+#ifndef _EXPERIMENTAL_INTRUSIVE_LIST_HPP_
+#define _EXPERIMENTAL_INTRUSIVE_LIST_HPP_
+
+#include "../experimental_alias_declarations.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+
+#ifdef _INTRUSIVE_LIST_UNINITIALIZED_ITERATOR_ASSERT_
+#undef _INTRUSIVE_LIST_UNINITIALIZED_ITERATOR_ASSERT_
+#endif
+// assert if iterator is uninitialized
+#define _INTRUSIVE_LIST_UNINITIALIZED_ITERATOR_ASSERT_(it) assert((it).pList_ != nullptr && (it).pCurrent_ != nullptr && "iterator is not initialized")
+
+namespace experimental {
+	/*	IntrusiveListHook class
+		the links of an object in an IntrusiveList, to be declared as a member of the object
+		Note:
+		- Copying an object does not copy its links: the copy is not in any list.
+		- An object must be removed from its list before it is destroyed.
+	*/
+	class IntrusiveListHook {
+	public:
+		IntrusiveListHook() noexcept = default;
+
+		IntrusiveListHook(IntrusiveListHook const &) noexcept {}
+
+		IntrusiveListHook& operator=(IntrusiveListHook const &) noexcept {
+			return *this;
+		}
+
+		~IntrusiveListHook() {
+			assert(!is_linked() && "object destroyed while in a list");
+		}
+
+		// check if the object is in a list
+		bool is_linked() const noexcept {
+			return next_ != nullptr;
+		}
+
+	private:
+		IntrusiveListHook *prev_ = nullptr;
+		IntrusiveListHook *next_ = nullptr;
+
+		/* Friend classes */
+		// ======================================================================
+		template<typename T, IntrusiveListHook T::*Hook>
+		friend class IntrusiveList;
+	};
+
+	/*	IntrusiveList ADT class
+		provides a doubly linked list of objects which already live elsewhere:
+		the links are the member 'Hook' of the objects, so inserting and erasing never allocate
+		and the list holds references to the objects, not copies.
+		The list is circular around a hook embedded in the list itself, which is the end.
+		- An object is in at most one list per hook, declare several hooks to put it in several lists.
+		- iterator_to() gets the iterator of an object in O(1), so an object can be erased or moved
+		  without a search, as in an LRU cache or a run queue.
+		Note:
+		- The list does not own the objects: erasing or clearing only unlinks them.
+		- The list can be moved but not copied.
+	*/
+	template<typename T, IntrusiveListHook T::*Hook>
+	class IntrusiveList {
+	private:
+		using hook_type = IntrusiveListHook;
+
+		/*	ConstIterator class
+			provides a wrapper of pointer to the hook of an object in IntrusiveList ADT
+			and basic operations
+		*/
+		class ConstIterator {
+		public:
+			using value_type = T;
+			using reference = value_type const &;
+			using pointer = value_type const *;
+			using difference_type = alias::pointer_difference_type;
+			using iterator_category = std::bidirectional_iterator_tag;
+
+			// Default constructor
+			ConstIterator() = delete;
+
+			/* Operator overloadings */
+			// ======================================================================
+
+			// dereference operator
+			reference operator*() const {
+				return retrieve();
+			}
+			pointer operator->() const {
+				return &retrieve();
+			}
+			// prefix increment operator
+			ConstIterator& operator++() {
+				_INTRUSIVE_LIST_UNINITIALIZED_ITERATOR_ASSERT_(*this);
+				assert(pCurrent_ != &pList_->end_ && "cannot increment pass the end");
+				pCurrent_ = pCurrent_->next_;
+				return *this;
+			}
+			// postfix increment operator
+			ConstIterator operator++(int) {
+				ConstIterator old = *this;
+				++(*this);
+				return old;
+			}
+			// prefix decrement operator
+			ConstIterator& operator--() {
+				_INTRUSIVE_LIST_UNINITIALIZED_ITERATOR_ASSERT_(*this);
+				assert(pCurrent_->prev_ != &pList_->end_ && "cannot decrement pass the head");
+				pCurrent_ = pCurrent_->prev_;
+				return *this;
+			}
+			// postfix decrement operator
+			ConstIterator operator--(int) {
+				ConstIterator old = *this;
+				--(*this);
+				return old;
+			}
+			// equal operator
+			bool operator==(ConstIterator const &rhs) const {
+				_INTRUSIVE_LIST_UNINITIALIZED_ITERATOR_ASSERT_(*this);
+				_INTRUSIVE_LIST_UNINITIALIZED_ITERATOR_ASSERT_(rhs);
+				assert(pList_ == rhs.pList_ && "compare mismatched iterators");
+				return pCurrent_ == rhs.pCurrent_;
+			}
+			// not equal operator
+			bool operator!=(ConstIterator const &rhs) const {
+				return !(*this == rhs);
+			}
+
+		protected:
+			IntrusiveList const *pList_;
+			hook_type *pCurrent_;
+
+			ConstIterator(IntrusiveList const *pList, hook_type *p) noexcept
+				: pList_{ pList }, pCurrent_{ p } {}
+
+			// retrieve the object of the current iterator
+			value_type& retrieve() const {
+				_INTRUSIVE_LIST_UNINITIALIZED_ITERATOR_ASSERT_(*this);
+				assert(pCurrent_ != &pList_->end_ && "cannot dereference pass-the-end");
+				return owner(pCurrent_);
+			}
+
+			/* Friend classes */
+			// ======================================================================
+			friend class IntrusiveList;
+		};
+
+		/*	Iterator class
+			inherit from ConstIterator class
+			point to non-const
+		*/
+		class Iterator : public ConstIterator {
+		public:
+			using value_type = typename ConstIterator::value_type;
+			using reference = value_type &;
+			using pointer = value_type *;
+			using difference_type = typename ConstIterator::difference_type;
+			using iterator_category = typename ConstIterator::iterator_category;
+
+			// Default constructor
+			Iterator() = delete;
+
+			/* Operator overloadings */
+			// ======================================================================
+
+			// dereference operator
+			reference operator*() const {
+				return ConstIterator::retrieve();
+			}
+			pointer operator->() const {
+				return &ConstIterator::retrieve();
+			}
+			// prefix increment operator
+			Iterator& operator++() {
+				ConstIterator::operator++();
+				return *this;
+			}
+			// postfix increment operator
+			Iterator operator++(int) {
+				Iterator old = *this;
+				ConstIterator::operator++();
+				return old;
+			}
+			// prefix decrement operator
+			Iterator& operator--() {
+				ConstIterator::operator--();
+				return *this;
+			}
+			// postfix decrement operator
+			Iterator operator--(int) {
+				Iterator old = *this;
+				ConstIterator::operator--();
+				return old;
+			}
+
+		protected:
+			Iterator(IntrusiveList const *pList, hook_type *p) noexcept
+				: ConstIterator{ pList, p } {}
+
+			/* Friend classes */
+			// ======================================================================
+			friend class IntrusiveList;
+		};
+
+	public:
+		using size_type = alias::size_type;
+		using value_type = T;
+		using reference = value_type &;
+		using const_reference = value_type const &;
+		using iterator = Iterator;
+		using const_iterator = ConstIterator;
+
+		/* The Big-Five */
+		// ======================================================================
+
+		// unlink the objects
+		~IntrusiveList() {
+			clear();
+			end_.prev_ = end_.next_ = nullptr;
+		}
+
+		IntrusiveList() noexcept {
+			init();
+		}
+
+		IntrusiveList(IntrusiveList const &) = delete;
+		IntrusiveList& operator=(IntrusiveList const &) = delete;
+
+		// the objects of 'l' are relinked to the hook of this list
+		IntrusiveList(IntrusiveList &&l) noexcept {
+			init();
+			take(l);
+		}
+
+		IntrusiveList& operator=(IntrusiveList &&rhs) noexcept {
+			if (this != &rhs) {
+				clear();
+				take(rhs);
+			}
+			return *this;
+		}
+
+		/* Element access */
+		// ======================================================================
+
+		// access the first object of the list
+		// do not check if the list is empty
+		reference front() {
+			return *begin();
+		}
+		const_reference front() const {
+			return *begin();
+		}
+		// access the last object of the list
+		// do not check if the list is empty
+		reference back() {
+			return owner(end_.prev_);
+		}
+		const_reference back() const {
+			return owner(end_.prev_);
+		}
+
+		/* Capacity operations */
+		// ======================================================================
+
+		// query the size of the list
+		size_type size() const {
+			return size_;
+		}
+		// check if the list is empty
+		bool empty() const {
+			return size() == 0;
+		}
+
+		/* Modifying operations */
+		// ======================================================================
+
+		// link 'item', which must not be in a list, before the iterator it
+		// return the iterator that points to 'item' in the list
+		iterator insert(const_iterator it, reference item) noexcept {
+			_INTRUSIVE_LIST_UNINITIALIZED_ITERATOR_ASSERT_(it);
+			assert(it.pList_ == this && "cannot insert into different lists");
+			assert(!(item.*Hook).is_linked() && "object is already in a list");
+
+			hook_type *p = it.pCurrent_;
+			hook_type *h = &(item.*Hook);
+			h->prev_ = p->prev_;
+			h->next_ = p;
+			p->prev_->next_ = h;
+			p->prev_ = h;
+			++size_;
+			return iterator(this, h);
+		}
+		// unlink the object pointed by the iterator from the list
+		// return the iterator that points to the next object of the list
+		iterator erase(const_iterator it) noexcept {
+			_INTRUSIVE_LIST_UNINITIALIZED_ITERATOR_ASSERT_(it);
+			assert(it.pList_ == this && "cannot erase iterator from different lists");
+			assert(it.pCurrent_ != &end_ && "cannot erase pass-the-end");
+
+			hook_type *p = it.pCurrent_;
+			hook_type *next = p->next_;
+			p->prev_->next_ = next;
+			next->prev_ = p->prev_;
+			p->prev_ = p->next_ = nullptr;
+			--size_;
+			return iterator(this, next);
+		}
+		// unlink objects from 'from' to, but not include, 'to' [from, to) from the list
+		// return 'to' iterator
+		iterator erase(const_iterator from, const_iterator to) noexcept {
+			while (from != to) {
+				from = erase(from);
+			}
+			return iterator(this, to.pCurrent_);
+		}
+		// unlink 'item', which must be in this list
+		void remove(reference item) noexcept {
+			erase(iterator_to(item));
+		}
+
+		// link item to the front of the list
+		void push_front(reference item) noexcept {
+			insert(begin(), item);
+		}
+		// link item to the back of the list
+		void push_back(reference item) noexcept {
+			insert(end(), item);
+		}
+		// unlink the first object of the list
+		// do not check if the list is empty
+		void pop_front() noexcept {
+			erase(begin());
+		}
+		// unlink the last object of the list
+		// do not check if the list is empty
+		void pop_back() noexcept {
+			erase(iterator(this, end_.prev_));
+		}
+		// unlink all the objects of the list
+		void clear() noexcept {
+			hook_type *p = end_.next_;
+			while (p != &end_) {
+				hook_type *next = p->next_;
+				p->prev_ = p->next_ = nullptr;
+				p = next;
+			}
+			init();
+		}
+
+		/* List operations */
+		// ======================================================================
+		// Iterators to the objects taken from 'other' still refer to 'other', do not use them.
+
+		// move all the objects of 'other' before 'pos'
+		void splice(const_iterator pos, IntrusiveList &other) noexcept {
+			splice(pos, other, other.begin(), other.end());
+		}
+		// move the object pointed by 'it' in 'other' before 'pos'
+		void splice(const_iterator pos, IntrusiveList &other, const_iterator it) noexcept {
+			_INTRUSIVE_LIST_UNINITIALIZED_ITERATOR_ASSERT_(it);
+			assert(it.pCurrent_ != &other.end_ && "cannot splice pass-the-end");
+
+			const_iterator next = it;
+			splice(pos, other, it, ++next);
+		}
+		// move the objects [first, last) of 'other' before 'pos', 'pos' must not be in [first, last)
+		// constant time if 'other' is this list or if [first, last) is the whole of 'other',
+		// otherwise linear in the number of objects moved
+		void splice(const_iterator pos, IntrusiveList &other, const_iterator first, const_iterator last) noexcept {
+			_INTRUSIVE_LIST_UNINITIALIZED_ITERATOR_ASSERT_(pos);
+			_INTRUSIVE_LIST_UNINITIALIZED_ITERATOR_ASSERT_(first);
+			_INTRUSIVE_LIST_UNINITIALIZED_ITERATOR_ASSERT_(last);
+			assert(pos.pList_ == this && "cannot splice into different lists");
+			assert(first.pList_ == &other && last.pList_ == &other && "iterators are not in the list spliced from");
+
+			if (first == last) {
+				return;
+			}
+			if (&other != this) {
+				size_type count = other.size_;
+				if (first.pCurrent_ != other.end_.next_ || last.pCurrent_ != &other.end_) {
+					count = 0;
+					for (hook_type *p = first.pCurrent_; p != last.pCurrent_; p = p->next_) {
+						++count;
+					}
+				}
+				other.size_ -= count;
+				size_ += count;
+			}
+			transfer(pos.pCurrent_, first.pCurrent_, last.pCurrent_);
+		}
+
+		/* Iterator operations */
+		// ======================================================================
+
+		// get the iterator pointing to the first object of the list
+		iterator begin() {
+			return iterator{ this, end_.next_ };
+		}
+		const_iterator begin() const {
+			return const_iterator{ this, end_.next_ };
+		}
+		const_iterator cbegin() const {
+			return begin();
+		}
+		// get the iterator pointing to the pass-the-last-object of the list
+		iterator end() {
+			return iterator{ this, const_cast<hook_type *>(&end_) };
+		}
+		const_iterator end() const {
+			return const_iterator{ this, const_cast<hook_type *>(&end_) };
+		}
+		const_iterator cend() const {
+			return end();
+		}
+		// get the iterator pointing to 'item', which must be in this list
+		iterator iterator_to(reference item) noexcept {
+			assert((item.*Hook).is_linked() && "object is not in a list");
+			return iterator{ this, &(item.*Hook) };
+		}
+		const_iterator iterator_to(const_reference item) const noexcept {
+			assert((item.*Hook).is_linked() && "object is not in a list");
+			return const_iterator{ this, const_cast<hook_type *>(&(item.*Hook)) };
+		}
+
+	private:
+		hook_type end_;
+		size_type size_;
+
+		// make the list empty: the end hook linked to itself
+		void init() noexcept {
+			end_.prev_ = end_.next_ = &end_;
+			size_ = 0;
+		}
+
+		// take the objects of 'l', which becomes empty, this list being empty
+		void take(IntrusiveList &l) noexcept {
+			if (!l.empty()) {
+				end_.next_ = l.end_.next_;
+				end_.prev_ = l.end_.prev_;
+				end_.next_->prev_ = end_.prev_->next_ = &end_;
+				size_ = l.size_;
+				l.init();
+			}
+		}
+
+		// get the object owning the hook 'h'
+		static value_type& owner(hook_type *h) noexcept {
+			return *reinterpret_cast<value_type *>(reinterpret_cast<unsigned char *>(h) - hook_offset());
+		}
+
+		// get the offset of the hook in the objects
+		static std::ptrdiff_t hook_offset() noexcept {
+			alignas(value_type) static unsigned char const object[sizeof(value_type)] = {};
+			value_type const *p = reinterpret_cast<value_type const *>(object);
+			return reinterpret_cast<unsigned char const *>(&(p->*Hook)) - object;
+		}
+
+		// unlink the hooks [first, last) and link them before 'pos', which is not one of them
+		static void transfer(hook_type *pos, hook_type *first, hook_type *last) noexcept {
+			if (first == last || pos == last) {
+				return;
+			}
+			hook_type *lastIn = last->prev_;
+			first->prev_->next_ = last;
+			last->prev_ = first->prev_;
+			first->prev_ = pos->prev_;
+			pos->prev_->next_ = first;
+			lastIn->next_ = pos;
+			pos->prev_ = lastIn;
+		}
+	};
+}
+
+#undef _INTRUSIVE_LIST_UNINITIALIZED_ITERATOR_ASSERT_
+
+#endif // !_EXPERIMENTAL_INTRUSIVE_LIST_HPP_
@@ -11,10 +11,14 @@
 #define _EXPERIMENTAL_LIST_HPP_
 
 #include "../experimental_alias_declarations.hpp"
+#include "../experimental_allocators.hpp"
 
 #include <utility>
 #include <cassert>
+#include <functional>
 #include <initializer_list>
+#include <memory>
+#include <type_traits>
 
 #ifdef _LIST_UNINITIALIZED_ITERATOR_ASSERT_
 #undef _LIST_UNINITIALIZED_ITERATOR_ASSERT_
@@ -25,26 +29,41 @@
 namespace experimental {
 	/* 	List ADT class
 		provides a generic container with non-contiguous memory block
+		Note:
+		- The list is circular around a sentinel embedded in the list, which holds no value:
+		  an empty list allocates nothing and T needs no default constructor.
+		- Nodes come from 'Allocator' rebound to the node type. With PoolAllocator they are carved
+		  from slabs, insert and erase pop and push a free list, and clear() frees them at once
+		  when the pool is not shared.
 	*/
-	template<typename T>
+	template<typename T, typename Allocator = experimental::Allocator<T>>
 	class List {
 	private:
+		/*	NodeBase class
+			the links of a node, the sentinel is a NodeBase without a value
+		*/
+		struct NodeBase {
+			NodeBase *prev_;
+			NodeBase *next_;
+		};
+
 		/*	Node class
 			implement the idea of a node in doubly linked list
 		*/
-		struct Node {
+		struct Node : NodeBase {
 			using value_type = T;
 
 			value_type data_;
-			Node *prev_;
-			Node *next_;
 
-			Node(value_type const &data = T{}, Node *prev = nullptr, Node *next = nullptr) noexcept
-				: data_{ data }, prev_{ prev }, next_{ next }{}
-			Node(value_type &&data, Node *prev = nullptr, Node *next = nullptr) noexcept
-				: data_{ std::move(data) }, prev_{ prev }, next_{ next }{}
+			// construct the data from 'args'
+			template<typename... Args>
+			Node(NodeBase *prev, NodeBase *next, Args &&...args)
+				: NodeBase{ prev, next }, data_(std::forward<Args>(args)...) {}
 		};
 
+		using node_allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+		using node_traits = std::allocator_traits<node_allocator_type>;
+
 		/*	ConstIterator class
 			provides a wrapper of pointer to const that points to nodes in List ADT
 			and basic operations
@@ -68,14 +87,14 @@ namespace experimental {
 			// prefix increment operator
 			ConstIterator& operator++() {
 				_LIST_UNINITIALIZED_ITERATOR_ASSERT_(*this);
-				assert(pCurrent_ != pList_->afterTail_ && "cannot increment pass the end");
+				assert(pCurrent_ != &pList_->end_ && "cannot increment pass the end");
 				pCurrent_ = pCurrent_->next_;
 				return *this;
 			}
 			// postfix increment operator
 			ConstIterator operator++(int) {
 				_LIST_UNINITIALIZED_ITERATOR_ASSERT_(*this);
-				assert(pCurrent_ != pList_->afterTail_ && "cannot increment pass the end");
+				assert(pCurrent_ != &pList_->end_ && "cannot increment pass the end");
 				auto old = *this;
 				++(*this);
 				return old;
@@ -83,14 +102,14 @@ namespace experimental {
 			// prefix decrememnt
 			ConstIterator& operator--() {
 				_LIST_UNINITIALIZED_ITERATOR_ASSERT_(*this);
-				assert(pCurrent_ != pList_->beforeHead_ && "cannot decrement pass the head");
+				assert(pCurrent_->prev_ != &pList_->end_ && "cannot decrement pass the head");
 				pCurrent_ = pCurrent_->prev_;
 				return *this;
 			}
 			// postfix decrement
 			ConstIterator operator--(int) {
 				_LIST_UNINITIALIZED_ITERATOR_ASSERT_(*this);
-				assert(pCurrent_ != pList_->beforeHead_ && "cannot decrement pass the head");
+				assert(pCurrent_->prev_ != &pList_->end_ && "cannot decrement pass the head");
 				ConstIterator old = *this;
 				--(*this);
 				return old;
@@ -111,21 +130,22 @@ namespace experimental {
 			}
 
 		protected:
-			List<value_type> const *pList_;
-			Node *pCurrent_;
+			List const *pList_;
+			NodeBase *pCurrent_;
 
-			ConstIterator(List<value_type> const *pList, Node *p) noexcept
+			ConstIterator(List const *pList, NodeBase *p) noexcept
 				: pList_{ pList }, pCurrent_{ p } {}
 
 			// retrieve data of the current iterator
 			reference retrieve() const {
 				_LIST_UNINITIALIZED_ITERATOR_ASSERT_(*this);
-				return pCurrent_->data_;
+				assert(pCurrent_ != &pList_->end_ && "cannot dereference pass-the-end");
+				return value_of(pCurrent_);
 			}
 			
 			/* Friend classes */
 			// ====================================================================== 
-			friend class List<value_type>;
+			friend class List;
 		};
 
 		/*	Iterator class
@@ -155,14 +175,14 @@ namespace experimental {
 			// prefix increment
 			Iterator& operator++() {
 				_LIST_UNINITIALIZED_ITERATOR_ASSERT_(*this);
-				assert(pCurrent_ != pList_->afterTail_ && "cannot increment pass the end");
+				assert(pCurrent_ != &pList_->end_ && "cannot increment pass the end");
 				pCurrent_ = pCurrent_->next_; 
 				return *this;
 			}
 			// postfix increment
 			Iterator operator++(int) {
 				_LIST_UNINITIALIZED_ITERATOR_ASSERT_(*this);
-				assert(pCurrent_ != pList_->afterTail_ && "cannot increment pass the end");
+				assert(pCurrent_ != &pList_->end_ && "cannot increment pass the end");
 				iterator old = *this;
 				++(*this);
 				return old;
@@ -170,14 +190,14 @@ namespace experimental {
 			// prefix decrememnt
 			Iterator& operator--() {
 				_LIST_UNINITIALIZED_ITERATOR_ASSERT_(*this);
-				assert(pCurrent_ != pList_->beforeHead_ && "cannot decrement pass the head");
+				assert(pCurrent_->prev_ != &pList_->end_ && "cannot decrement pass the head");
 				pCurrent_ = pCurrent_->prev_; 
 				return *this;
 			}
 			// postfix decrement
 			Iterator operator--(int) {
 				_LIST_UNINITIALIZED_ITERATOR_ASSERT_(*this);
-				assert(pCurrent_ != pList_->beforeHead_ && "cannot decrement pass the head");
+				assert(pCurrent_->prev_ != &pList_->end_ && "cannot decrement pass the head");
 				Iterator old = *this;
 				pCurrent_ = pCurrent_->prev_;
 				return old;
@@ -187,12 +207,12 @@ namespace experimental {
 			using ConstIterator::pList_;
 			using ConstIterator::pCurrent_;
 
-			Iterator(List<value_type> const *pList, Node *p) noexcept
+			Iterator(List const *pList, NodeBase *p) noexcept
 				: ConstIterator{ pList, p } {}
 
 			/* Friend classes */
 			// ====================================================================== 
-			friend class List<value_type>;
+			friend class List;
 		};
 
 	public:
@@ -200,6 +220,7 @@ namespace experimental {
 		using value_type = typename Node::value_type;
 		using reference = value_type &;
 		using const_reference = value_type const &;
+		using allocator_type = Allocator;
 		using iterator = Iterator;
 		using const_iterator = ConstIterator;
 
@@ -208,58 +229,83 @@ namespace experimental {
 
 		~List() {
 			clear();
-			delete beforeHead_;
-			delete afterTail_;
 		}
 
-		List() {
+		List()
+			: List(allocator_type()) {}
+
+		explicit List(allocator_type const &a) noexcept
+			: nodeAllocator_(a) {
 			init();
 		}
 
-		List(List const &l) {
-			init();
+		List(List const &l)
+			: List(std::allocator_traits<allocator_type>::select_on_container_copy_construction(l.get_allocator())) {
 			for (auto &e : l) {
 				push_back(e);
 			}
 		}
 
+		// the nodes of 'l' are relinked to the sentinel of this list, 'l' is left empty
 		List(List &&l) noexcept
-			: size_{ l.size_ }, beforeHead_{ l.beforeHead_ }, afterTail_{ l.afterTail_ } {
-			l.size_ = 0;
-			l.beforeHead_ = nullptr;
-			l.afterTail_ = nullptr;
+			: nodeAllocator_(l.nodeAllocator_), end_(l.end_), size_{ l.size_ } {
+			relink_sentinel();
+			l.init();
 		}
 
 		List& operator=(List const &rhs) {
-			List cpy = rhs; // expensive operation
-			using std::swap;
-			swap(*this, cpy);
+			if (this != &rhs) {
+				// the nodes are released by the allocator that got them before it is replaced
+				clear();
+				if constexpr (node_traits::propagate_on_container_copy_assignment::value) {
+					nodeAllocator_ = rhs.nodeAllocator_;
+				}
+				for (auto &e : rhs) {
+					push_back(e);
+				}
+			}
 			return *this;
 		}
 
-		List& operator=(List &&rhs) noexcept {
-			using std::swap;
-			swap(size_, rhs.size_);
-			swap(beforeHead_, rhs.beforeHead_);
-			swap(afterTail_, rhs.afterTail_);
+		// the nodes of 'rhs' are taken over if the allocator propagates or both allocators are equal,
+		// otherwise the elements are moved one by one
+		List& operator=(List &&rhs) noexcept(node_traits::propagate_on_container_move_assignment::value
+											 || node_traits::is_always_equal::value) {
+			if (this == &rhs) {
+				return *this;
+			}
+			clear();
+			if constexpr (node_traits::propagate_on_container_move_assignment::value) {
+				nodeAllocator_ = rhs.nodeAllocator_;
+			}
+			else if (nodeAllocator_ != rhs.nodeAllocator_) {
+				// the nodes of 'rhs' cannot be taken over: move the elements one by one
+				for (auto &e : rhs) {
+					emplace_back(std::move(e));
+				}
+				rhs.clear();
+				return *this;
+			}
+			end_ = rhs.end_;
+			size_ = rhs.size_;
+			relink_sentinel();
+			rhs.init();
 			return *this;
 		}
 
 		/* Custom constructor */
 		// ======================================================================
 
-		explicit List(std::initializer_list<T> const &ul) {
-			init();
+		explicit List(std::initializer_list<T> const &ul, allocator_type const &a = allocator_type())
+			: List(a) {
 			for (auto const &e : ul) {
 				push_back(e);
 			}
 		}
 
-		explicit List(std::initializer_list<T> &&ul) {
-			init();
-			for (auto &&e : ul) {
-				push_back(std::move(e));
-			}
+		// get a copy of the allocator
+		allocator_type get_allocator() const {
+			return allocator_type(nodeAllocator_);
 		}
 
 		/* Element access */
@@ -299,36 +345,36 @@ namespace experimental {
 
 		// insert item before the iterator it
 		// return the iterator that points to the new item in the list
-		iterator insert(iterator it, value_type const &item) {
-			_LIST_UNINITIALIZED_ITERATOR_ASSERT_(it);
-			assert(it.pList_ == this && "cannot insert into different lists");
-			assert(it.pCurrent_ != beforeHead_ && "cannot insert before before-head");
-			
-			auto p = it.pCurrent_;
-			++size_;
-			return iterator(this, p->prev_ = p->prev_->next_ = new Node{ item, p->prev_, p });
+		iterator insert(const_iterator it, value_type const &item) {
+			return emplace(it, item);
+		}
+		iterator insert(const_iterator it, value_type &&item) {
+			return emplace(it, std::move(item));
 		}
-		iterator insert(iterator it, value_type &&item) {
+		// construct an element from 'args' in a new node before the iterator it
+		// return the iterator that points to the new element in the list
+		template<typename... Args>
+		iterator emplace(const_iterator it, Args &&...args) {
 			_LIST_UNINITIALIZED_ITERATOR_ASSERT_(it);
 			assert(it.pList_ == this && "cannot insert into different lists");
-			assert(it.pCurrent_ != beforeHead_ && "cannot insert before before-head");
 
 			auto p = it.pCurrent_;
+			Node *node = create_node(p->prev_, p, std::forward<Args>(args)...);
 			++size_;
-			return iterator(this, p->prev_ = p->prev_->next_ = new Node{ std::move(item), p->prev_, p });
+			return iterator(this, p->prev_ = p->prev_->next_ = node);
 		}
 		// remove the element pointed by the iterator from the list
 		// return the iterator that points to the next element of the list
 		iterator erase(iterator it) {
 			_LIST_UNINITIALIZED_ITERATOR_ASSERT_(it);
 			assert(it.pList_ == this && "cannot erase iterator from different lists");
-			assert(it.pCurrent_ != beforeHead_ && it.pCurrent_ != afterTail_ && "cannot erase pass-the-end");
+			assert(it.pCurrent_ != &end_ && "cannot erase pass-the-end");
 
 			auto p = it.pCurrent_;
 			auto retVal = ++it;
 			p->prev_->next_ = p->next_;
 			p->next_->prev_ = p->prev_;
-			delete p;
+			destroy_node(static_cast<Node *>(p));
 			--size_;
 			return retVal;
 		}
@@ -338,7 +384,6 @@ namespace experimental {
 			_LIST_UNINITIALIZED_ITERATOR_ASSERT_(from);
 			_LIST_UNINITIALIZED_ITERATOR_ASSERT_(to);
 			assert(from.pList_ == this && to.pList_ == this && "cannot erase iterators from different lists");
-			assert(from.pCurrent_ != beforeHead_ && "cannot erase from before-head");
 
 			for (; from != to; from = erase(from));
 			return to;
@@ -358,6 +403,16 @@ namespace experimental {
 		void push_back(value_type &&item) {
 			insert(end(), std::move(item));
 		}
+		// construct an element from 'args' in the front of the list
+		template<typename... Args>
+		reference emplace_front(Args &&...args) {
+			return *emplace(begin(), std::forward<Args>(args)...);
+		}
+		// construct an element from 'args' in the back of the list
+		template<typename... Args>
+		reference emplace_back(Args &&...args) {
+			return *emplace(end(), std::forward<Args>(args)...);
+		}
 		// remove the first element of the list
 		// do not check if the list is empty
 		void pop_front() {
@@ -369,49 +424,280 @@ namespace experimental {
 			erase(--end());
 		}
 		// remove all the elements of the list
+		// the nodes of a pool that is not shared are freed at once
 		void clear() {
-			if (size_ > 0) {
-				erase(begin(), end());
+			if (size_ == 0) {
+				return;
+			}
+			if constexpr (details::has_pool_reset<node_allocator_type>::value) {
+				if (!nodeAllocator_.is_shared()) {
+					if constexpr (!std::is_trivially_destructible<value_type>::value) {
+						for (NodeBase *p = end_.next_; p != &end_;) {
+							NodeBase *next = p->next_;
+							node_traits::destroy(nodeAllocator_, static_cast<Node *>(p));
+							p = next;
+						}
+					}
+					nodeAllocator_.reset();
+					init();
+					return;
+				}
+			}
+			erase(begin(), end());
+		}
+
+		// the allocators are exchanged only if they propagate on swap, otherwise they must be equal
+		void swap(List &other) noexcept {
+			using std::swap;
+			if constexpr (node_traits::propagate_on_container_swap::value) {
+				swap(nodeAllocator_, other.nodeAllocator_);
+			}
+			else {
+				assert(nodeAllocator_ == other.nodeAllocator_ && "cannot swap lists with unequal allocators");
+			}
+			swap(end_, other.end_);
+			swap(size_, other.size_);
+			relink_sentinel();
+			other.relink_sentinel();
+		}
+
+		/* List operations */
+		// ======================================================================
+		// These relink nodes: no element is copied or moved, nothing is allocated.
+		// The nodes taken from 'other' must be released by the allocator of this list,
+		// so both allocators must compare equal.
+		// Iterators to the elements taken from 'other' still refer to 'other', do not use them.
+
+		// move all the elements of 'other' before 'pos'
+		void splice(iterator pos, List &other) {
+			splice(pos, other, other.begin(), other.end());
+		}
+		void splice(iterator pos, List &&other) {
+			splice(pos, other);
+		}
+		// move the element pointed by 'it' in 'other' before 'pos'
+		void splice(iterator pos, List &other, iterator it) {
+			_LIST_UNINITIALIZED_ITERATOR_ASSERT_(it);
+			assert(it.pList_ == &other && "iterator is not in the list spliced from");
+			assert(it.pCurrent_ != &other.end_ && "cannot splice pass-the-end");
+
+			iterator next = it;
+			splice(pos, other, it, ++next);
+		}
+		// move the elements [first, last) of 'other' before 'pos', 'pos' must not be in [first, last)
+		// constant time if 'other' is this list or if [first, last) is the whole of 'other',
+		// otherwise linear in the number of elements moved
+		void splice(iterator pos, List &other, iterator first, iterator last) {
+			_LIST_UNINITIALIZED_ITERATOR_ASSERT_(pos);
+			_LIST_UNINITIALIZED_ITERATOR_ASSERT_(first);
+			_LIST_UNINITIALIZED_ITERATOR_ASSERT_(last);
+			assert(pos.pList_ == this && "cannot splice into different lists");
+			assert(first.pList_ == &other && last.pList_ == &other && "iterators are not in the list spliced from");
+			assert(nodeAllocator_ == other.nodeAllocator_ && "cannot splice lists with unequal allocators");
+
+			if (first == last) {
+				return;
+			}
+			if (&other != this) {
+				size_type count = other.size_;
+				if (first.pCurrent_ != other.end_.next_ || last.pCurrent_ != &other.end_) {
+					count = 0;
+					for (NodeBase *p = first.pCurrent_; p != last.pCurrent_; p = p->next_) {
+						++count;
+					}
+				}
+				other.size_ -= count;
+				size_ += count;
+			}
+			transfer(pos.pCurrent_, first.pCurrent_, last.pCurrent_);
+		}
+
+		// merge the sorted list 'other' into this sorted list, 'other' becomes empty
+		// stable: of equal elements, those of this list come first
+		template<typename Compare>
+		void merge(List &other, Compare cmp) {
+			assert(nodeAllocator_ == other.nodeAllocator_ && "cannot merge lists with unequal allocators");
+
+			if (&other == this) {
+				return;
 			}
+			NodeBase *p1 = end_.next_;
+			NodeBase *p2 = other.end_.next_;
+			while (p1 != &end_ && p2 != &other.end_) {
+				if (cmp(value_of(p2), value_of(p1))) {
+					NodeBase *next = p2->next_;
+					transfer(p1, p2, next);
+					p2 = next;
+					++size_;
+					--other.size_;
+				}
+				else {
+					p1 = p1->next_;
+				}
+			}
+			transfer(&end_, p2, &other.end_);
+			size_ += other.size_;
+			other.size_ = 0;
+		}
+		void merge(List &other) {
+			merge(other, std::less<value_type>());
+		}
+		template<typename Compare>
+		void merge(List &&other, Compare cmp) {
+			merge(other, cmp);
+		}
+		void merge(List &&other) {
+			merge(other);
+		}
+
+		// sort the list with a bottom-up merge sort which relinks the nodes
+		// stable, O(n log(n)) comparisons, O(1) extra memory
+		// precondition: 'cmp' does not throw
+		template<typename Compare>
+		void sort(Compare cmp) {
+			if (size_ < 2) {
+				return;
+			}
+			// runs[i] is a sorted run of 2^i nodes linked by next_ only, or null,
+			// the runs of higher ranks hold the earlier elements
+			NodeBase *runs[MAX_RUNS] = {};
+			NodeBase *p = end_.next_;
+			end_.prev_->next_ = nullptr;
+			while (p) {
+				NodeBase *carry = p;
+				p = p->next_;
+				carry->next_ = nullptr;
+				size_type rank = 0;
+				for (; runs[rank]; ++rank) {
+					carry = merge_runs(runs[rank], carry, cmp);
+					runs[rank] = nullptr;
+				}
+				runs[rank] = carry;
+			}
+			NodeBase *sorted = nullptr;
+			for (size_type rank = 0; rank < MAX_RUNS; ++rank) {
+				if (runs[rank]) {
+					sorted = sorted ? merge_runs(runs[rank], sorted, cmp) : runs[rank];
+				}
+			}
+			// restore the previous links
+			NodeBase *prev = &end_;
+			for (; sorted; prev = sorted, sorted = sorted->next_) {
+				prev->next_ = sorted;
+				sorted->prev_ = prev;
+			}
+			prev->next_ = &end_;
+			end_.prev_ = prev;
+		}
+		void sort() {
+			sort(std::less<value_type>());
 		}
 
 		/* Iterator operations */
 		// ======================================================================
 
 		// get the iterator pointing to the first element of the list
-		// do not check if the list is empty
 		iterator begin() {
-			return iterator{ this, beforeHead_->next_ };
+			return iterator{ this, end_.next_ };
 		}
 		const_iterator begin() const {
-			return const_iterator{ this, beforeHead_->next_ };
+			return const_iterator{ this, end_.next_ };
 		}
 		const_iterator cbegin() const {
 			return begin();
 		}
 		// get the iterator pointing to the pass-the-last-element of the list
 		iterator end() {
-			return iterator{ this, afterTail_ };
+			return iterator{ this, &end_ };
 		}
 		const_iterator end() const {
-			return iterator{ this, afterTail_ };
+			return const_iterator{ this, const_cast<NodeBase *>(&end_) };
 		}
 		const_iterator cend() const {
 			return end();
 		}
 
 	private:
+		// enough runs to sort as many nodes as fit in memory
+		static constexpr size_type MAX_RUNS = 8 * sizeof(size_type);
+
+		node_allocator_type nodeAllocator_;
+		NodeBase end_;		// the sentinel: next_ is the first node, prev_ the last one
 		size_type size_;
-		Node *beforeHead_;
-		Node *afterTail_;
 
-		// create an empty list
-		void init() {
+		// make the list empty: the sentinel linked to itself
+		void init() noexcept {
+			end_.prev_ = end_.next_ = &end_;
 			size_ = 0;
-			beforeHead_ = new Node{};
-			afterTail_ = new Node{};
-			beforeHead_->next_ = afterTail_;
-			afterTail_->prev_ = beforeHead_;
+		}
+
+		// point the first and the last nodes to the sentinel after it was copied from another list
+		void relink_sentinel() noexcept {
+			if (size_ == 0) {
+				end_.prev_ = end_.next_ = &end_;
+			}
+			else {
+				end_.next_->prev_ = &end_;
+				end_.prev_->next_ = &end_;
+			}
+		}
+
+		// get the value of a node which is not the sentinel
+		static value_type& value_of(NodeBase *p) noexcept {
+			return static_cast<Node *>(p)->data_;
+		}
+
+		// allocate a node and construct its data from 'args'
+		template<typename... Args>
+		Node* create_node(NodeBase *prev, NodeBase *next, Args &&...args) {
+			Node *p = node_traits::allocate(nodeAllocator_, 1);
+			try {
+				node_traits::construct(nodeAllocator_, p, prev, next, std::forward<Args>(args)...);
+			}
+			catch (...) {
+				node_traits::deallocate(nodeAllocator_, p, 1);
+				throw;
+			}
+			return p;
+		}
+
+		void destroy_node(Node *p) noexcept {
+			node_traits::destroy(nodeAllocator_, p);
+			node_traits::deallocate(nodeAllocator_, p, 1);
+		}
+
+		// unlink the nodes [first, last) and link them before 'pos', which is not one of them
+		static void transfer(NodeBase *pos, NodeBase *first, NodeBase *last) noexcept {
+			if (first == last || pos == last) {
+				return;
+			}
+			NodeBase *lastIn = last->prev_;
+			first->prev_->next_ = last;
+			last->prev_ = first->prev_;
+			first->prev_ = pos->prev_;
+			pos->prev_->next_ = first;
+			lastIn->next_ = pos;
+			pos->prev_ = lastIn;
+		}
+
+		// merge the null-terminated sorted runs 'a' and 'b', of which 'a' holds the earlier elements
+		template<typename Compare>
+		static NodeBase* merge_runs(NodeBase *a, NodeBase *b, Compare &cmp) {
+			NodeBase *head = nullptr;
+			NodeBase **tail = &head;
+			while (a && b) {
+				if (cmp(value_of(b), value_of(a))) {
+					*tail = b;
+					b = b->next_;
+				}
+				else {
+					*tail = a;
+					a = a->next_;
+				}
+				tail = &(*tail)->next_;
+			}
+			*tail = a ? a : b;
+			return head;
 		}
 	};
 
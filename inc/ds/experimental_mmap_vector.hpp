@@ -0,0 +1,286 @@
+/*
+ *	File name:	"experimental_mmap_vector.hpp"
+ *	Date:		10/18/2026 11:02:54 PM
+ *	Author:		Vo, Dinh Tue Minh
+ *	Purpose:	Implementation of vector ADT backed by a memory-mapped file
+ */
+
+#pragma once
+
+#ifndef _EXPERIMENTAL_MMAP_VECTOR_HPP_
+#define _EXPERIMENTAL_MMAP_VECTOR_HPP_
+
+#include "experimental_vector.hpp"
+
+#ifdef __linux__
+
+#include <cerrno>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace experimental {
+	// how MMapVector opens its file
+	enum class MMapMode {
+		READ_WRITE,		// create the file if needed, changes are written to the file
+		READ_ONLY		// the elements must not be changed, the vector cannot grow
+	};
+
+	/*	MappedFileAllocator class
+		allocates the storage of a vector as a shared mapping of a file:
+		- allocate() resizes the file with ftruncate and maps it
+		- reallocate() resizes the file and remaps it with mremap, without copying
+		- deallocate() unmaps it, the file is kept
+		Note:
+		- The allocator does not own the file descriptor.
+		- Only one block of a file may be in use at a time, as every block starts at offset 0.
+	*/
+	template<typename T>
+	class MappedFileAllocator {
+	public:
+		using value_type = T;
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+		using is_always_equal = std::false_type;
+		using propagate_on_container_copy_assignment = std::true_type;
+		using propagate_on_container_move_assignment = std::true_type;
+		using propagate_on_container_swap = std::true_type;
+
+		explicit MappedFileAllocator(int fd = -1, bool readOnly = false) noexcept
+			: fd_{ fd }, readOnly_{ readOnly } {}
+
+		template<typename U>
+		MappedFileAllocator(MappedFileAllocator<U> const &a) noexcept
+			: fd_{ a.fd() }, readOnly_{ a.read_only() } {}
+
+		// get the mapped file descriptor
+		int fd() const noexcept {
+			return fd_;
+		}
+
+		// check if the file is mapped read-only
+		bool read_only() const noexcept {
+			return readOnly_;
+		}
+
+		// resize the file to 'n' elements and map it
+		value_type* allocate(size_type n) {
+			check_writable();
+			resize_file(n);
+			return map(n);
+		}
+
+		// map the first 'n' elements of the file, which must be long enough
+		value_type* map(size_type n) {
+			int protection = readOnly_ ? PROT_READ : PROT_READ | PROT_WRITE;
+			void *p = mmap(nullptr, n * sizeof(value_type), protection, MAP_SHARED, fd_, 0);
+			if (p == MAP_FAILED) {
+				throw std::system_error(errno, std::generic_category(), "cannot map the file");
+			}
+			return static_cast<value_type *>(p);
+		}
+
+		// unmap storage got from allocate() or map()
+		void deallocate(value_type *p, size_type n) noexcept {
+			munmap(static_cast<void *>(p), n * sizeof(value_type));
+		}
+
+		// resize the file and the mapping from 'oldN' to 'newN' elements
+		value_type* reallocate(value_type *p, size_type oldN, size_type newN) {
+			check_writable();
+			if (newN > oldN) {
+				resize_file(newN);
+			}
+			void *newP = mremap(static_cast<void *>(p), oldN * sizeof(value_type), newN * sizeof(value_type), MREMAP_MAYMOVE);
+			if (newP == MAP_FAILED) {
+				throw std::system_error(errno, std::generic_category(), "cannot remap the file");
+			}
+			if (newN < oldN) {
+				resize_file(newN);
+			}
+			return static_cast<value_type *>(newP);
+		}
+
+	private:
+		int fd_;
+		bool readOnly_;
+
+		void check_writable() const {
+			if (readOnly_) {
+				throw std::logic_error("cannot resize a read-only mapped file");
+			}
+		}
+
+		void resize_file(size_type n) const {
+			if (ftruncate(fd_, static_cast<off_t>(n * sizeof(value_type))) != 0) {
+				throw std::system_error(errno, std::generic_category(), "cannot resize the mapped file");
+			}
+		}
+	};
+
+	template<typename T, typename U>
+	bool operator==(MappedFileAllocator<T> const &lhs, MappedFileAllocator<U> const &rhs) noexcept {
+		return lhs.fd() == rhs.fd();
+	}
+
+	template<typename T, typename U>
+	bool operator!=(MappedFileAllocator<T> const &lhs, MappedFileAllocator<U> const &rhs) noexcept {
+		return !(lhs == rhs);
+	}
+
+	/*	MMapVector ADT class
+		a Vector whose elements live in a file, which holds the raw bytes of the elements.
+		Opening maps the file instead of reading it, so the pages are loaded on first access
+		and are shared with the other processes mapping the same file.
+		- The file grows with ftruncate and the mapping with mremap.
+		- sync() writes the changes back with msync, closing truncates the file to size().
+		Note:
+		- Linux only.
+		- value_type must be trivially copyable.
+		- While the vector is open the file is as long as the capacity,
+		  the trailing unused capacity stays in the file if the process dies.
+		- In READ_ONLY mode the elements must not be changed (writes fault)
+		  and growing throws std::logic_error.
+		- The growth is page-rounded by default, as the mapping is made of whole pages.
+		- It cannot be copied. Copying it as a Vector would map the same file again,
+		  copy the elements into a Vector with another allocator instead.
+	*/
+	template<typename T, typename GrowthPolicy = PageRoundedGrowth<DefaultGrowth, 0>>
+	class MMapVector : public Vector<T, MappedFileAllocator<T>, GrowthPolicy> {
+	private:
+		using Base = Vector<T, MappedFileAllocator<T>, GrowthPolicy>;
+
+	public:
+		using value_type = typename Base::value_type;
+		using reference = typename Base::reference;
+		using const_reference = typename Base::const_reference;
+		using size_type = typename Base::size_type;
+		using allocator_type = typename Base::allocator_type;
+		using growth_policy = typename Base::growth_policy;
+
+		using iterator = typename Base::iterator;
+		using const_iterator = typename Base::const_iterator;
+
+		static_assert(std::is_trivially_copyable<value_type>::value, "the elements of a mapped file must be trivially copyable");
+
+		/* The Big-Five */
+		// ===============================================================================
+		~MMapVector() {
+			close();
+		}
+
+		// open the file at 'path' and map its elements
+		// throw std::system_error if the file cannot be opened or mapped,
+		// std::runtime_error if its size is not a multiple of the element size
+		explicit MMapVector(std::string const &path, MMapMode mode = MMapMode::READ_WRITE)
+			: Base(allocator_type(open_file(path, mode), mode == MMapMode::READ_ONLY)),
+			fd_{ this->get_allocator().fd() }, readOnly_{ mode == MMapMode::READ_ONLY } {
+			try {
+				struct stat st;
+				if (fstat(fd_, &st) != 0) {
+					throw std::system_error(errno, std::generic_category(), "cannot read the size of " + path);
+				}
+				size_type bytes = static_cast<size_type>(st.st_size);
+				if (bytes % sizeof(value_type) != 0) {
+					throw std::runtime_error(path + " does not hold whole elements");
+				}
+				size_type sz = bytes / sizeof(value_type);
+				if (sz > 0) {
+					allocator_type allocator = this->get_allocator();
+					this->adopt_storage(allocator.map(sz), sz, sz);
+				}
+			}
+			catch (...) {
+				::close(fd_);
+				throw;
+			}
+		}
+
+		MMapVector(MMapVector const &) = delete;
+		MMapVector& operator=(MMapVector const &) = delete;
+
+		MMapVector(MMapVector &&v) noexcept
+			: Base(std::move(v)), fd_{ v.fd_ }, readOnly_{ v.readOnly_ } {
+			v.fd_ = -1;
+		}
+
+		MMapVector& operator=(MMapVector &&rhs) noexcept {
+			if (this != &rhs) {
+				close();
+				Base::operator=(std::move(rhs));
+				fd_ = rhs.fd_;
+				readOnly_ = rhs.readOnly_;
+				rhs.fd_ = -1;
+			}
+			return *this;
+		}
+
+		/* Modifiers */
+		// ===============================================================================
+		void swap(MMapVector &v) {
+			Base::swap(v);
+			std::swap(fd_, v.fd_);
+			std::swap(readOnly_, v.readOnly_);
+		}
+
+		friend void swap(MMapVector &lhs, MMapVector &rhs) {
+			lhs.swap(rhs);
+		}
+
+		/* File operations */
+		// ===============================================================================
+
+		// check if the file is mapped read-only
+		bool read_only() const noexcept {
+			return readOnly_;
+		}
+
+		// write the changed elements back to the file and wait for the writes
+		// throw std::system_error if msync fails
+		void sync() {
+			if (fd_ >= 0 && !readOnly_ && this->size() > 0
+				&& msync(static_cast<void *>(this->data()), this->size() * sizeof(value_type), MS_SYNC) != 0) {
+				throw std::system_error(errno, std::generic_category(), "cannot sync the mapped file");
+			}
+		}
+
+	private:
+		int fd_;
+		bool readOnly_;
+
+		static int open_file(std::string const &path, MMapMode mode) {
+			int fd = mode == MMapMode::READ_ONLY
+				? ::open(path.c_str(), O_RDONLY | O_CLOEXEC)
+				: ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+			if (fd < 0) {
+				throw std::system_error(errno, std::generic_category(), "cannot open " + path);
+			}
+			return fd;
+		}
+
+		// cut the unused capacity off the file and close it
+		// the mapping is released by the base class
+		void close() noexcept {
+			if (fd_ < 0) {
+				return;
+			}
+			if (!readOnly_) {
+				(void)ftruncate(fd_, static_cast<off_t>(this->size() * sizeof(value_type)));
+			}
+			::close(fd_);
+			fd_ = -1;
+		}
+	};
+}
+
+#endif // __linux__
+
+#endif // !_EXPERIMENTAL_MMAP_VECTOR_HPP_
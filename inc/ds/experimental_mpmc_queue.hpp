@@ -0,0 +1,337 @@
+/*
+ *	File name:	"experimental_mpmc_queue.hpp"
+ *	Date:		10/19/2026 8:47:13 AM
+ *	Author:		Vo, Dinh Tue Minh
+ *	Purpose:	Implementation of lock-free multi-producer multi-consumer queues:
+ *				a bounded ring of sequenced cells and an unbounded linked queue
+ */
+
+#pragma once
+
+#ifndef _EXPERIMENTAL_MPMC_QUEUE_HPP_
+#define _EXPERIMENTAL_MPMC_QUEUE_HPP_
+
+#include "../experimental_alias_declarations.hpp"
+#include "../experimental_concurrency.hpp"
+
+#include <atomic>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace experimental {
+	/*	BoundedMPMCQueue ADT class
+		provides a lock-free FIFO queue of a fixed capacity, a power of 2, shared by any number
+		of producers and consumers (D. Vyukov's bounded MPMC queue).
+		Each cell has a sequence number telling whose turn it is:
+		- sequence == position: free for the producer which claims 'position'
+		- sequence == position + 1: full for the consumer which claims 'position'
+		A producer claims a position with a compare-and-swap of the enqueue position, writes the cell,
+		then publishes it by setting its sequence, and symmetrically for consumers,
+		so producers and consumers only contend on their own position and on the cell they share.
+		- try_push() and try_pop() fail at once when the queue is full or empty,
+		  push() and pop() wait with a Backoff.
+		Note:
+		- The enqueue and dequeue positions are on their own cache lines, the cells are not padded
+		  so that consecutive cells share cache lines as in an array.
+		- A claimed cell must be published, or the threads of the next lap wait on it forever:
+		  the elements are built and handed out outside of the claimed cells,
+		  which are only filled and emptied by moves that cannot throw.
+	*/
+	template<typename T>
+	class BoundedMPMCQueue {
+	public:
+		using value_type = T;
+		using size_type = alias::size_type;
+
+		static_assert(std::is_nothrow_move_constructible<T>::value, "the elements must be nothrow move constructible");
+
+		/* The Big-Five */
+		// ===============================================================================
+
+		~BoundedMPMCQueue() {
+			size_type tail = enqueuePos_.load(std::memory_order_relaxed);
+			for (size_type pos = dequeuePos_.load(std::memory_order_relaxed); pos != tail; ++pos) {
+				cells_[pos & mask_].value()->~T();
+			}
+			delete[] cells_;
+		}
+
+		// create a queue of 'capacity' elements, rounded up to a power of 2
+		explicit BoundedMPMCQueue(size_type capacity)
+			: mask_{ round_up_power_of_2(capacity) - 1 }, cells_{ new Cell[mask_ + 1] } {
+			for (size_type i = 0; i <= mask_; ++i) {
+				cells_[i].sequence_.store(i, std::memory_order_relaxed);
+			}
+		}
+
+		BoundedMPMCQueue(BoundedMPMCQueue const &) = delete;
+		BoundedMPMCQueue& operator=(BoundedMPMCQueue const &) = delete;
+
+		/* Capacity operations */
+		// ===============================================================================
+
+		// query the capacity of the queue
+		size_type capacity() const noexcept {
+			return mask_ + 1;
+		}
+
+		// get an estimate of the number of elements, exact when no thread uses the queue
+		size_type size_approx() const noexcept {
+			size_type tail = enqueuePos_.load(std::memory_order_relaxed);
+			size_type head = dequeuePos_.load(std::memory_order_relaxed);
+			return tail > head ? tail - head : 0;
+		}
+
+		/* Modifying operations */
+		// ===============================================================================
+
+		// construct an element from 'args' at the back of the queue
+		// return false if the queue is full
+		template<typename... Args>
+		bool try_emplace(Args &&...args) {
+			// build the element before claiming a cell, its constructor may throw
+			T item(std::forward<Args>(args)...);
+			Cell *cell;
+			size_type pos = enqueuePos_.load(std::memory_order_relaxed);
+			for (;;) {
+				cell = &cells_[pos & mask_];
+				size_type sequence = cell->sequence_.load(std::memory_order_acquire);
+				auto diff = static_cast<alias::pointer_difference_type>(sequence - pos);
+				if (diff == 0) {
+					if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+						break;
+					}
+				}
+				else if (diff < 0) {
+					return false;
+				}
+				else {
+					pos = enqueuePos_.load(std::memory_order_relaxed);
+				}
+			}
+			::new (static_cast<void *>(&cell->storage_)) T(std::move(item));
+			cell->sequence_.store(pos + 1, std::memory_order_release);
+			return true;
+		}
+		bool try_push(T const &item) {
+			return try_emplace(item);
+		}
+		bool try_push(T &&item) {
+			return try_emplace(std::move(item));
+		}
+
+		// move the front element to 'item' and remove it
+		// return false if the queue is empty
+		bool try_pop(T &item) {
+			Cell *cell;
+			size_type pos = dequeuePos_.load(std::memory_order_relaxed);
+			for (;;) {
+				cell = &cells_[pos & mask_];
+				size_type sequence = cell->sequence_.load(std::memory_order_acquire);
+				auto diff = static_cast<alias::pointer_difference_type>(sequence - (pos + 1));
+				if (diff == 0) {
+					if (dequeuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+						break;
+					}
+				}
+				else if (diff < 0) {
+					return false;
+				}
+				else {
+					pos = dequeuePos_.load(std::memory_order_relaxed);
+				}
+			}
+			T *p = cell->value();
+			T value(std::move(*p));
+			p->~T();
+			// free for the producer of the next lap
+			cell->sequence_.store(pos + mask_ + 1, std::memory_order_release);
+			// the assignment may throw once the cell is published
+			item = std::move(value);
+			return true;
+		}
+
+		// add 'item' to the back of the queue, wait while the queue is full
+		void push(T const &item) {
+			for (Backoff backoff; !try_push(item); backoff.pause());
+		}
+		void push(T &&item) {
+			for (Backoff backoff; !try_push(std::move(item)); backoff.pause());
+		}
+
+		// remove the front element, wait while the queue is empty
+		T pop() {
+			T item;
+			for (Backoff backoff; !try_pop(item); backoff.pause());
+			return item;
+		}
+
+	private:
+		struct Cell {
+			std::atomic<size_type> sequence_;
+			typename std::aligned_storage<sizeof(T), alignof(T)>::type storage_;
+
+			T* value() noexcept {
+				return std::launder(reinterpret_cast<T *>(&storage_));
+			}
+		};
+
+		size_type const mask_;
+		Cell *const cells_;
+		alignas(CACHE_LINE_SIZE) std::atomic<size_type> enqueuePos_{ 0 };
+		alignas(CACHE_LINE_SIZE) std::atomic<size_type> dequeuePos_{ 0 };
+
+		static size_type round_up_power_of_2(size_type n) {
+			if (n < 2) {
+				return 2;
+			}
+			size_type p = 1;
+			while (p < n) {
+				p <<= 1;
+			}
+			return p;
+		}
+	};
+
+	/*	MPMCQueue ADT class
+		provides an unbounded lock-free FIFO queue shared by any number of producers and consumers
+		(M. Michael and M. Scott's queue): a singly linked list from a dummy head node to the tail,
+		producers link new nodes after the tail and consumers move the head forward.
+		The popped head nodes are retired to the epoch-based reclamation, so that a thread reading
+		a node never reads freed memory, and the nodes are never reused while a thread may hold them (ABA).
+		- try_push() always succeeds, unless the allocation fails,
+		  try_pop() fails at once when the queue is empty and pop() waits with a Backoff.
+		Note:
+		- Every push allocates a node, prefer BoundedMPMCQueue when a bound is known.
+	*/
+	template<typename T>
+	class MPMCQueue {
+	public:
+		using value_type = T;
+		using size_type = alias::size_type;
+
+		/* The Big-Five */
+		// ===============================================================================
+
+		~MPMCQueue() {
+			Node *p = head_.load(std::memory_order_relaxed);
+			// the head is the dummy, its value was moved out or never constructed
+			Node *next = p->next_.load(std::memory_order_relaxed);
+			delete p;
+			for (p = next; p; p = next) {
+				next = p->next_.load(std::memory_order_relaxed);
+				p->value()->~T();
+				delete p;
+			}
+		}
+
+		MPMCQueue()
+			: head_{ new Node }, tail_{ head_.load(std::memory_order_relaxed) } {}
+
+		MPMCQueue(MPMCQueue const &) = delete;
+		MPMCQueue& operator=(MPMCQueue const &) = delete;
+
+		/* Modifying operations */
+		// ===============================================================================
+
+		// construct an element from 'args' at the back of the queue
+		template<typename... Args>
+		bool try_emplace(Args &&...args) {
+			Node *node = new Node;
+			try {
+				::new (static_cast<void *>(&node->storage_)) T(std::forward<Args>(args)...);
+			}
+			catch (...) {
+				delete node;
+				throw;
+			}
+			EpochGuard guard;
+			for (Backoff backoff;; backoff.pause()) {
+				Node *tail = tail_.load(std::memory_order_acquire);
+				Node *next = tail->next_.load(std::memory_order_acquire);
+				if (tail != tail_.load(std::memory_order_acquire)) {
+					continue;
+				}
+				if (next) {
+					// help the producer which linked 'next' to move the tail
+					tail_.compare_exchange_weak(tail, next, std::memory_order_release, std::memory_order_relaxed);
+				}
+				else if (tail->next_.compare_exchange_weak(next, node, std::memory_order_release, std::memory_order_relaxed)) {
+					tail_.compare_exchange_strong(tail, node, std::memory_order_release, std::memory_order_relaxed);
+					return true;
+				}
+			}
+		}
+		bool try_push(T const &item) {
+			return try_emplace(item);
+		}
+		bool try_push(T &&item) {
+			return try_emplace(std::move(item));
+		}
+		// add 'item' to the back of the queue
+		void push(T const &item) {
+			try_emplace(item);
+		}
+		void push(T &&item) {
+			try_emplace(std::move(item));
+		}
+
+		// move the front element to 'item' and remove it
+		// return false if the queue is empty
+		bool try_pop(T &item) {
+			EpochGuard guard;
+			for (Backoff backoff;; backoff.pause()) {
+				Node *head = head_.load(std::memory_order_acquire);
+				Node *tail = tail_.load(std::memory_order_acquire);
+				Node *next = head->next_.load(std::memory_order_acquire);
+				if (head != head_.load(std::memory_order_acquire)) {
+					continue;
+				}
+				if (!next) {
+					return false;
+				}
+				if (head == tail) {
+					// the tail lags behind, help it
+					tail_.compare_exchange_weak(tail, next, std::memory_order_release, std::memory_order_relaxed);
+				}
+				else if (head_.compare_exchange_weak(head, next, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+					// 'next' is the new dummy, only the winner of the exchange reads its value
+					T *p = next->value();
+					item = std::move(*p);
+					p->~T();
+					retire(head);
+					return true;
+				}
+			}
+		}
+
+		// remove the front element, wait while the queue is empty
+		T pop() {
+			T item;
+			for (Backoff backoff; !try_pop(item); backoff.pause());
+			return item;
+		}
+
+		// check if the queue is empty, exact when no thread uses the queue
+		bool empty() const {
+			EpochGuard guard;
+			return head_.load(std::memory_order_acquire)->next_.load(std::memory_order_acquire) == nullptr;
+		}
+
+	private:
+		struct Node {
+			std::atomic<Node *> next_{ nullptr };
+			typename std::aligned_storage<sizeof(T), alignof(T)>::type storage_;
+
+			T* value() noexcept {
+				return std::launder(reinterpret_cast<T *>(&storage_));
+			}
+		};
+
+		alignas(CACHE_LINE_SIZE) std::atomic<Node *> head_;
+		alignas(CACHE_LINE_SIZE) std::atomic<Node *> tail_;
+	};
+}
+
+#endif // !_EXPERIMENTAL_MPMC_QUEUE_HPP_
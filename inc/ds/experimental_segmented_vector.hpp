@@ -0,0 +1,742 @@
+/*
+ *	File name:	"experimental_segmented_vector.hpp"
+ *	Date:		10/19/2026 12:14:37 AM
+ *	Author:		Vo, Dinh Tue Minh
+ *	Purpose:	Implementation of segmented vector and deque ADTs:
+ *				elements are stored in fixed-size chunks indexed by a directory
+ */
+
+#pragma once
+
+#ifndef _EXPERIMENTAL_SEGMENTED_VECTOR_HPP_
+#define _EXPERIMENTAL_SEGMENTED_VECTOR_HPP_
+
+#include "../experimental_alias_declarations.hpp"
+#include "../experimental_allocators.hpp"
+#include "experimental_vector.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace experimental {
+	namespace details {
+		// get the number of elements of a chunk:
+		// the greatest power of 2 whose elements fit in 'ChunkBytes', at least 1
+		template<typename T, alias::size_type ChunkBytes>
+		constexpr alias::size_type chunk_length() noexcept {
+			alias::size_type n = 1;
+			while (n * 2 * sizeof(T) <= ChunkBytes) {
+				n *= 2;
+			}
+			return n;
+		}
+
+		// get the base-2 logarithm of 'n', a power of 2
+		constexpr alias::size_type log2_of_power_of_2(alias::size_type n) noexcept {
+			alias::size_type shift = 0;
+			while ((alias::size_type{ 1 } << shift) < n) {
+				++shift;
+			}
+			return shift;
+		}
+	}
+
+	/*	SegmentedVector ADT class
+		provides a random-access container whose elements are stored in chunks of CHUNK_SIZE elements,
+		a power of 2 that fits in 'ChunkBytes'. A directory (a Vector of chunk pointers) indexes the chunks:
+		the element at index i is in chunk (head + i) / CHUNK_SIZE, so indexing costs a shift,
+		a mask and two loads.
+		- Growing allocates one chunk and at most grows the directory,
+		  the elements are never moved nor copied, and there is no transient double-size block.
+		- References and pointers to the elements stay valid until the elements are removed.
+		Note:
+		- Iterators are invalidated by every insertion, as the directory may be reallocated.
+		- Removed elements leave their chunks allocated for reuse, shrink_to_fit() releases them.
+		- Deque adds the insertion and removal at the front.
+	*/
+	template<typename T, alias::size_type ChunkBytes = 4096, typename Allocator = experimental::Allocator<T>>
+	class SegmentedVector {
+	private:
+		using alloc_traits = std::allocator_traits<Allocator>;
+		using directory_type = Vector<T *, typename alloc_traits::template rebind_alloc<T *>>;
+
+		/*	ConstIterator class
+			points to an element by its position in the chunks,
+			the position of the first element being 'head'.
+			Note:
+			- An iterator holds the chunk table, which is not updated when the directory grows.
+		*/
+		class ConstIterator {
+		public:
+			using value_type = T;
+			using reference = value_type const &;
+			using pointer = value_type const *;
+			using difference_type = alias::pointer_difference_type;
+			using iterator_category = std::random_access_iterator_tag;
+
+			// Default constructor: a singular iterator
+			ConstIterator() noexcept = default;
+
+			/* Operator overloadings */
+			// ======================================================================
+
+			// dereference operator
+			reference operator*() const {
+				return retrieve();
+			}
+			pointer operator->() const {
+				return &retrieve();
+			}
+			// subscript operator
+			reference operator[](difference_type n) const {
+				return *(*this + n);
+			}
+			// prefix increment
+			ConstIterator& operator++() {
+				++position_;
+				return *this;
+			}
+			// postfix increment
+			ConstIterator operator++(int) {
+				ConstIterator old = *this;
+				++position_;
+				return old;
+			}
+			// prefix decrement
+			ConstIterator& operator--() {
+				--position_;
+				return *this;
+			}
+			// postfix decrement
+			ConstIterator operator--(int) {
+				ConstIterator old = *this;
+				--position_;
+				return old;
+			}
+			// comparison operators
+			bool operator==(ConstIterator const &rhs) const {
+				return position_ == rhs.position_;
+			}
+			bool operator!=(ConstIterator const &rhs) const {
+				return position_ != rhs.position_;
+			}
+			bool operator<(ConstIterator const &rhs) const {
+				return position_ < rhs.position_;
+			}
+			bool operator>(ConstIterator const &rhs) const {
+				return position_ > rhs.position_;
+			}
+			bool operator<=(ConstIterator const &rhs) const {
+				return position_ <= rhs.position_;
+			}
+			bool operator>=(ConstIterator const &rhs) const {
+				return position_ >= rhs.position_;
+			}
+			// increment operator
+			ConstIterator operator+(difference_type n) const {
+				ConstIterator it = *this;
+				it.position_ += n;
+				return it;
+			}
+			friend ConstIterator operator+(difference_type n, ConstIterator const &it) {
+				return it + n;
+			}
+			ConstIterator& operator+=(difference_type n) {
+				position_ += n;
+				return *this;
+			}
+			// decrement operator
+			ConstIterator operator-(difference_type n) const {
+				ConstIterator it = *this;
+				it.position_ -= n;
+				return it;
+			}
+			ConstIterator& operator-=(difference_type n) {
+				position_ -= n;
+				return *this;
+			}
+			// arithmetic operator
+			difference_type operator-(ConstIterator const &rhs) const {
+				return static_cast<difference_type>(position_ - rhs.position_);
+			}
+
+		protected:
+			value_type *const *chunks_ = nullptr;
+			alias::size_type position_ = 0;
+
+			ConstIterator(value_type *const *chunks, alias::size_type position) noexcept
+				: chunks_{ chunks }, position_{ position } {}
+
+			value_type& retrieve() const {
+				assert(chunks_ && "uninitialized iterator");
+				return chunks_[position_ >> SHIFT][position_ & MASK];
+			}
+
+			/* Friend classes */
+			// ======================================================================
+			friend class SegmentedVector;
+
+		};
+
+		/*	Iterator class
+			inherit from ConstIterator class
+			point to non-const
+		*/
+		class Iterator : public ConstIterator {
+		public:
+			using value_type = typename ConstIterator::value_type;
+			using reference = value_type &;
+			using pointer = value_type *;
+			using difference_type = typename ConstIterator::difference_type;
+
+			// Default constructor: a singular iterator
+			Iterator() noexcept = default;
+
+			/* Operator overloadings */
+			// ======================================================================
+
+			// dereference
+			reference operator*() const {
+				return ConstIterator::retrieve();
+			}
+			pointer operator->() const {
+				return &ConstIterator::retrieve();
+			}
+			// subscript operator
+			reference operator[](difference_type n) const {
+				return *(*this + n);
+			}
+			// prefix increment operator
+			Iterator& operator++() {
+				++position_;
+				return *this;
+			}
+			// postfix increment operator
+			Iterator operator++(int) {
+				Iterator old = *this;
+				++position_;
+				return old;
+			}
+			// prefix decrement operator
+			Iterator& operator--() {
+				--position_;
+				return *this;
+			}
+			// postfix decrement operator
+			Iterator operator--(int) {
+				Iterator old = *this;
+				--position_;
+				return old;
+			}
+			// increment operator
+			Iterator operator+(difference_type n) const {
+				Iterator it = *this;
+				it.position_ += n;
+				return it;
+			}
+			friend Iterator operator+(difference_type n, Iterator const &it) {
+				return it + n;
+			}
+			Iterator& operator+=(difference_type n) {
+				position_ += n;
+				return *this;
+			}
+			// decrement operator
+			Iterator operator-(difference_type n) const {
+				Iterator it = *this;
+				it.position_ -= n;
+				return it;
+			}
+			Iterator& operator-=(difference_type n) {
+				position_ -= n;
+				return *this;
+			}
+			// arithmetic operator, hidden by the decrement operator without this declaration
+			using ConstIterator::operator-;
+
+		protected:
+			using ConstIterator::position_;
+
+			Iterator(value_type *const *chunks, alias::size_type position) noexcept
+				: ConstIterator(chunks, position) {}
+
+			/* Friend classes */
+			// ======================================================================
+			friend class SegmentedVector;
+
+		};
+
+	public:
+		using value_type = T;
+		using reference = value_type &;
+		using const_reference = value_type const &;
+		using size_type = alias::size_type;
+		using allocator_type = Allocator;
+
+		using iterator = Iterator;
+		using const_iterator = ConstIterator;
+
+		// number of elements of a chunk
+		static constexpr size_type CHUNK_SIZE = details::chunk_length<T, ChunkBytes>();
+
+		/* The Big-Five */
+		// ===============================================================================
+		~SegmentedVector() {
+			clear();
+			release_chunks();
+		}
+
+		SegmentedVector() noexcept(noexcept(allocator_type()))
+			: SegmentedVector(allocator_type()) {}
+
+		explicit SegmentedVector(allocator_type const &a) noexcept
+			: allocator_{ a }, directory_(typename directory_type::allocator_type(a)),
+			head_{ 0 }, size_{ 0 }, chunkCount_{ 0 } {}
+
+		// create a segmented vector of 'sz' value-initialized elements
+		explicit SegmentedVector(size_type sz, allocator_type const &a = allocator_type())
+			: SegmentedVector(a) {
+			resize(sz);
+		}
+
+		SegmentedVector(SegmentedVector const &v)
+			: SegmentedVector(alloc_traits::select_on_container_copy_construction(v.allocator_)) {
+			append(v);
+		}
+
+		// the chunks are taken over, no element is moved
+		SegmentedVector(SegmentedVector &&v) noexcept
+			: allocator_{ std::move(v.allocator_) }, directory_(std::move(v.directory_)),
+			head_{ v.head_ }, size_{ v.size_ }, chunkCount_{ v.chunkCount_ } {
+			v.forget_chunks();
+		}
+
+		SegmentedVector& operator=(SegmentedVector const &rhs) {
+			if (this != &rhs) {
+				clear();
+				if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+					if (allocator_ != rhs.allocator_) {
+						// the chunks must be released by the allocator that got them
+						release_chunks();
+					}
+					allocator_ = rhs.allocator_;
+				}
+				append(rhs);
+			}
+			return *this;
+		}
+
+		SegmentedVector& operator=(SegmentedVector &&rhs) noexcept(alloc_traits::propagate_on_container_move_assignment::value
+																   || alloc_traits::is_always_equal::value) {
+			if (this == &rhs) {
+				return *this;
+			}
+			clear();
+			if constexpr (!alloc_traits::propagate_on_container_move_assignment::value) {
+				if (allocator_ != rhs.allocator_) {
+					// the chunks of 'rhs' cannot be taken over: move the elements one by one
+					for (auto &x : rhs) {
+						emplace_back(std::move(x));
+					}
+					rhs.clear();
+					return *this;
+				}
+			}
+			release_chunks();
+			if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+				allocator_ = rhs.allocator_;
+			}
+			directory_ = std::move(rhs.directory_);
+			head_ = rhs.head_;
+			size_ = rhs.size_;
+			chunkCount_ = rhs.chunkCount_;
+			rhs.forget_chunks();
+			return *this;
+		}
+
+		/* Custom constructors */
+		// ===============================================================================
+		SegmentedVector(std::initializer_list<value_type> l, allocator_type const &a = allocator_type())
+			: SegmentedVector(a) {
+			for (auto const &x : l) {
+				push_back(x);
+			}
+		}
+
+		// get a copy of the allocator
+		allocator_type get_allocator() const noexcept {
+			return allocator_;
+		}
+
+		/* Element access */
+		// ===============================================================================
+
+		// Indexing: operator[]
+		// return a reference to the element at index idx
+		// do not check if the index is out-of-bound
+		reference operator[](size_type idx) {
+			return *slot(head_ + idx);
+		}
+		const_reference operator[](size_type idx) const {
+			return *slot(head_ + idx);
+		}
+
+		// return a reference to the element at index idx
+		// throw std::out_of_range if the index is out-of-bound
+		reference at(size_type idx) {
+			check_index(idx);
+			return (*this)[idx];
+		}
+		const_reference at(size_type idx) const {
+			check_index(idx);
+			return (*this)[idx];
+		}
+
+		// get the first element
+		// do not check if the container is empty
+		reference front() {
+			return (*this)[0];
+		}
+		const_reference front() const {
+			return (*this)[0];
+		}
+
+		// get the last element
+		// do not check if the container is empty
+		reference back() {
+			return (*this)[size_ - 1];
+		}
+		const_reference back() const {
+			return (*this)[size_ - 1];
+		}
+
+		/* Capacity operations */
+		// ===============================================================================
+
+		// query the number of elements
+		size_type size() const noexcept {
+			return size_;
+		}
+
+		// check if the container is empty
+		// return true if empty, false otherwise
+		bool empty() const noexcept {
+			return size_ == 0;
+		}
+
+		// query the number of elements the allocated chunks can hold
+		size_type capacity() const noexcept {
+			return chunkCount_ * CHUNK_SIZE;
+		}
+
+		// allocate the chunks to append elements up to 'newCapacity' without allocating
+		void reserve(size_type newCapacity) {
+			size_type end = head_ + newCapacity;
+			while (directory_.size() * CHUNK_SIZE < end) {
+				directory_.push_back(nullptr);
+			}
+			for (size_type c = (head_ + size_) >> SHIFT, last = (end + MASK) >> SHIFT; c < last; ++c) {
+				ensure_chunk(c);
+			}
+		}
+
+		// resize the container
+		// new elements are value-initialized, removed elements are destroyed
+		void resize(size_type newSize) {
+			while (size_ > newSize) {
+				pop_back();
+			}
+			while (size_ < newSize) {
+				emplace_back();
+			}
+		}
+		void resize(size_type newSize, const_reference value) {
+			while (size_ > newSize) {
+				pop_back();
+			}
+			while (size_ < newSize) {
+				push_back(value);
+			}
+		}
+
+		// release the chunks that hold no element and shrink the directory to the chunks in use
+		void shrink_to_fit() {
+			if (size_ == 0) {
+				release_chunks();
+				directory_.shrink_to_fit();
+				return;
+			}
+			size_type first = head_ >> SHIFT;
+			size_type last = (head_ + size_ + MASK) >> SHIFT;
+			for (size_type c = 0; c < directory_.size(); ++c) {
+				if ((c < first || c >= last) && directory_[c]) {
+					deallocate_chunk(directory_[c]);
+					directory_[c] = nullptr;
+				}
+			}
+			directory_.resize(last);
+			directory_.erase(directory_.begin(), directory_.begin() + first);
+			directory_.shrink_to_fit();
+			head_ -= first << SHIFT;
+		}
+
+		/* Modifiers */
+		// ===============================================================================
+
+		// push an element to the back
+		void push_back(const_reference value) {
+			emplace_back(value);
+		}
+		void push_back(value_type &&value) {
+			emplace_back(std::move(value));
+		}
+
+		// construct an element in place at the back and return it
+		template<typename... Args>
+		reference emplace_back(Args &&...args) {
+			value_type *p = back_slot();
+			alloc_traits::construct(allocator_, p, std::forward<Args>(args)...);
+			++size_;
+			return *p;
+		}
+
+		// remove the last element
+		// do not check if the container is empty
+		void pop_back() {
+			--size_;
+			alloc_traits::destroy(allocator_, slot(head_ + size_));
+		}
+
+		// remove all the elements, the chunks are kept
+		void clear() noexcept {
+			if constexpr (!std::is_trivially_destructible<value_type>::value) {
+				for (size_type pos = head_, end = head_ + size_; pos < end; ++pos) {
+					alloc_traits::destroy(allocator_, slot(pos));
+				}
+			}
+			size_ = 0;
+		}
+
+		// exchange the elements with 'v', no element is moved
+		void swap(SegmentedVector &v) noexcept {
+			using std::swap;
+			if constexpr (alloc_traits::propagate_on_container_swap::value) {
+				swap(allocator_, v.allocator_);
+			}
+			directory_.swap(v.directory_);
+			swap(head_, v.head_);
+			swap(size_, v.size_);
+			swap(chunkCount_, v.chunkCount_);
+		}
+
+		friend void swap(SegmentedVector &lhs, SegmentedVector &rhs) noexcept {
+			lhs.swap(rhs);
+		}
+
+		/* Iterator operations */
+		// ===============================================================================
+
+		// get the iterator to the first element
+		iterator begin() {
+			return { directory_.data(), head_ };
+		}
+		const_iterator begin() const {
+			return cbegin();
+		}
+		const_iterator cbegin() const {
+			return { directory_.data(), head_ };
+		}
+
+		// get the past-the-last iterator
+		iterator end() {
+			return { directory_.data(), head_ + size_ };
+		}
+		const_iterator end() const {
+			return cend();
+		}
+		const_iterator cend() const {
+			return { directory_.data(), head_ + size_ };
+		}
+
+	protected:
+		// construct an element in place before the first one and return it
+		template<typename... Args>
+		reference construct_front(Args &&...args) {
+			value_type *p = front_slot();
+			alloc_traits::construct(allocator_, p, std::forward<Args>(args)...);
+			--head_;
+			++size_;
+			return *p;
+		}
+
+		// remove the first element
+		// do not check if the container is empty
+		void erase_front() {
+			alloc_traits::destroy(allocator_, slot(head_));
+			++head_;
+			--size_;
+		}
+
+	private:
+		static constexpr size_type SHIFT = details::log2_of_power_of_2(CHUNK_SIZE);
+		static constexpr size_type MASK = CHUNK_SIZE - 1;
+
+		allocator_type allocator_;
+		directory_type directory_;	// the chunks, null if not allocated
+		size_type head_;			// position of the first element in the chunks
+		size_type size_;
+		size_type chunkCount_;		// number of allocated chunks
+
+		void check_index(size_type idx) const {
+			if (idx >= size_) {
+				throw std::out_of_range("SegmentedVector index out of range");
+			}
+		}
+
+		// get the storage at 'position' in the chunks, whose chunk must be allocated
+		value_type* slot(size_type position) const noexcept {
+			return directory_[position >> SHIFT] + (position & MASK);
+		}
+
+		// make room for an element before the first one and get its uninitialized storage
+		value_type* front_slot() {
+			if (head_ == 0) {
+				grow_directory_front();
+			}
+			ensure_chunk((head_ - 1) >> SHIFT);
+			return slot(head_ - 1);
+		}
+
+		// make room for an element after the last one and get its uninitialized storage
+		value_type* back_slot() {
+			if (((head_ + size_) >> SHIFT) == directory_.size()) {
+				grow_directory_back();
+			}
+			ensure_chunk((head_ + size_) >> SHIFT);
+			return slot(head_ + size_);
+		}
+
+		// append a slot to the directory
+		// the chunks before the first element are moved to the back instead,
+		// if they are a quarter of the directory, so that a queue keeps reusing its chunks
+		void grow_directory_back() {
+			size_type spare = head_ >> SHIFT;
+			if (spare > 0 && spare >= directory_.size() / 4) {
+				std::rotate(directory_.begin(), directory_.begin() + spare, directory_.end());
+				head_ -= spare << SHIFT;
+			}
+			else {
+				directory_.push_back(nullptr);
+			}
+		}
+
+		// prepend slots to the directory, doubling it
+		// the chunks after the last element are moved to the front instead,
+		// if they are a quarter of the directory
+		void grow_directory_front() {
+			size_type used = (head_ + size_ + MASK) >> SHIFT;
+			size_type spare = directory_.size() - used;
+			if (spare > 0 && spare >= directory_.size() / 4) {
+				std::rotate(directory_.begin(), directory_.begin() + used, directory_.end());
+				head_ += spare << SHIFT;
+			}
+			else {
+				size_type n = directory_.empty() ? 1 : directory_.size();
+				directory_.insert(directory_.begin(), n, nullptr);
+				head_ += n << SHIFT;
+			}
+		}
+
+		// allocate chunk 'c' of the directory if it is not
+		void ensure_chunk(size_type c) {
+			if (!directory_[c]) {
+				directory_[c] = alloc_traits::allocate(allocator_, CHUNK_SIZE);
+				++chunkCount_;
+			}
+		}
+
+		void deallocate_chunk(value_type *chunk) noexcept {
+			alloc_traits::deallocate(allocator_, chunk, CHUNK_SIZE);
+			--chunkCount_;
+		}
+
+		// release all the chunks, the container must be empty
+		void release_chunks() noexcept {
+			for (size_type c = 0; c < directory_.size(); ++c) {
+				if (directory_[c]) {
+					deallocate_chunk(directory_[c]);
+				}
+			}
+			directory_.clear();
+			head_ = 0;
+		}
+
+		// leave the chunks to the container that took the directory
+		void forget_chunks() noexcept {
+			directory_.clear();
+			head_ = size_ = chunkCount_ = 0;
+		}
+
+		void append(SegmentedVector const &v) {
+			reserve(v.size_);
+			for (auto const &x : v) {
+				push_back(x);
+			}
+		}
+	};
+
+	/*	Deque ADT class
+		a SegmentedVector that also inserts and removes elements at the front in O(1).
+		Note:
+		- The directory grows at the front by doubling, and a deque used as a queue
+		  recycles the chunks emptied at the front instead of allocating new ones.
+	*/
+	template<typename T, alias::size_type ChunkBytes = 4096, typename Allocator = experimental::Allocator<T>>
+	class Deque : public SegmentedVector<T, ChunkBytes, Allocator> {
+	private:
+		using Base = SegmentedVector<T, ChunkBytes, Allocator>;
+
+	public:
+		using value_type = typename Base::value_type;
+		using reference = typename Base::reference;
+		using const_reference = typename Base::const_reference;
+		using size_type = typename Base::size_type;
+		using allocator_type = typename Base::allocator_type;
+
+		using iterator = typename Base::iterator;
+		using const_iterator = typename Base::const_iterator;
+
+		using Base::Base;
+
+		/* Modifiers */
+		// ===============================================================================
+
+		// push an element to the front
+		void push_front(const_reference value) {
+			emplace_front(value);
+		}
+		void push_front(value_type &&value) {
+			emplace_front(std::move(value));
+		}
+
+		// construct an element in place at the front and return it
+		template<typename... Args>
+		reference emplace_front(Args &&...args) {
+			return this->construct_front(std::forward<Args>(args)...);
+		}
+
+		// remove the first element
+		// do not check if the deque is empty
+		void pop_front() {
+			this->erase_front();
+		}
+	};
+}
+
+#endif // !_EXPERIMENTAL_SEGMENTED_VECTOR_HPP_
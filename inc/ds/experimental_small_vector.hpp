@@ -0,0 +1,168 @@
+/*
+ *	File name:	"experimental_small_vector.hpp"
+ *	Date:		10/18/2026 8:26:40 PM
+ *	Author:		Vo, Dinh Tue Minh
+ *	Purpose:	Implementation of vector ADT with small buffer optimization
+ */
+
+#pragma once
+
+#ifndef _EXPERIMENTAL_SMALL_VECTOR_HPP_
+#define _EXPERIMENTAL_SMALL_VECTOR_HPP_
+
+#include "experimental_vector.hpp"
+
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace experimental {
+	/*	SmallVector ADT class
+		a Vector that keeps up to N elements inline, inside the object,
+		and spills to storage from the allocator only when it grows beyond N.
+		Note:
+		- It is a Vector: it has the same interface and iterator types,
+		  and can be passed wherever a Vector& is expected.
+		- Moving a SmallVector whose elements are inline moves the elements one by one.
+		  A SmallVector must be moved as a SmallVector: moving it through a Vector&& only takes over heap storage.
+	*/
+	template<typename T, alias::size_type N, typename Allocator = experimental::Allocator<T>, typename GrowthPolicy = DefaultGrowth>
+	class SmallVector : public Vector<T, Allocator, GrowthPolicy> {
+	private:
+		using Base = Vector<T, Allocator, GrowthPolicy>;
+
+	public:
+		using value_type = typename Base::value_type;
+		using reference = typename Base::reference;
+		using const_reference = typename Base::const_reference;
+		using size_type = typename Base::size_type;
+		using allocator_type = typename Base::allocator_type;
+		using growth_policy = typename Base::growth_policy;
+
+		using iterator = typename Base::iterator;
+		using const_iterator = typename Base::const_iterator;
+
+		static_assert(N > 0, "the inline capacity must not be 0");
+
+		/* The Big-Five */
+		// ===============================================================================
+		~SmallVector() {
+			// destroy the inline elements while the inline storage is alive
+			this->clear();
+		}
+
+		SmallVector() noexcept(noexcept(allocator_type()))
+			: SmallVector(allocator_type()) {}
+
+		explicit SmallVector(allocator_type const &a) noexcept
+			: Base(inline_elements(), N, a) {}
+
+		// create a small vector of 'sz' value-initialized elements
+		explicit SmallVector(size_type sz, allocator_type const &a = allocator_type())
+			: SmallVector(a) {
+			this->resize(sz);
+		}
+
+		SmallVector(SmallVector const &v)
+			: SmallVector(std::allocator_traits<allocator_type>::select_on_container_copy_construction(v.get_allocator())) {
+			this->append(v.data(), v.data() + v.size());
+		}
+
+		// inline elements are moved one by one into the inline storage, which always has room for them,
+		// heap storage is taken over
+		SmallVector(SmallVector &&v) noexcept(nothrow_relocatable)
+			: SmallVector(v.get_allocator()) {
+			take_elements(v);
+		}
+
+		SmallVector& operator=(SmallVector const &rhs) {
+			Base::operator=(rhs);
+			restore_inline();
+			return *this;
+		}
+
+		SmallVector& operator=(SmallVector &&rhs) noexcept(nothrow_relocatable
+															 && noexcept(std::declval<Base &>() = std::declval<Base &&>())) {
+			if (this == &rhs) {
+				return *this;
+			}
+			this->clear();
+			if (!this->move_allocator(rhs)) {
+				// the storage of 'rhs' cannot be taken over: move the elements one by one
+				restore_inline();
+				this->append(std::make_move_iterator(rhs.begin()), std::make_move_iterator(rhs.end()));
+				rhs.clear();
+				return *this;
+			}
+			take_elements(rhs);
+			return *this;
+		}
+
+		/* Custom constructors */
+		// ===============================================================================
+		explicit SmallVector(std::initializer_list<value_type> l, allocator_type const &a = allocator_type())
+			: SmallVector(a) {
+			this->append(l.begin(), l.end());
+		}
+
+		/* Capacity operations */
+		// ===============================================================================
+
+		// query the number of elements kept inline
+		static constexpr size_type inline_capacity() noexcept {
+			return N;
+		}
+
+		// check if the elements are kept inline
+		bool is_small() const noexcept {
+			return this->is_inline();
+		}
+
+		// reduce the capacity to the size, moving the elements back inline if they fit
+		void shrink_to_fit() {
+			if (!this->is_inline() && this->size() <= N) {
+				this->use_inline_storage(inline_elements(), N);
+			}
+			else {
+				Base::shrink_to_fit();
+			}
+		}
+
+	private:
+		// moving inline elements cannot throw
+		static constexpr bool nothrow_relocatable = is_trivially_relocatable_v<value_type>
+			|| std::is_nothrow_move_constructible<value_type>::value;
+
+		std::aligned_storage_t<sizeof(value_type), alignof(value_type)> inlineStorage_[N];
+
+		// get the inline storage, which is not initialized when the base class is constructed
+		value_type* inline_elements() noexcept {
+			return reinterpret_cast<value_type *>(inlineStorage_);
+		}
+
+		// keep a capacity of at least N: use the inline storage again if the storage was released,
+		// given to another vector or shrunk below N through the base class
+		void restore_inline() {
+			if (!this->is_inline() && this->capacity() < N) {
+				this->use_inline_storage(inline_elements(), N);
+			}
+		}
+
+		// take over the elements of 'v' and leave it empty, this vector must be empty
+		// the inline storage of this vector holds the inline elements of 'v'
+		void take_elements(SmallVector &v) {
+			restore_inline();
+			if (v.is_inline()) {
+				this->relocate_elements(v);
+			}
+			else {
+				this->take_storage(v);
+				v.restore_inline();
+				restore_inline();
+			}
+		}
+	};
+}
+
+#endif // !_EXPERIMENTAL_SMALL_VECTOR_HPP_
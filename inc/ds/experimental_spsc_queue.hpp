@@ -0,0 +1,228 @@
+/*
+ *	File name:	"experimental_spsc_queue.hpp"
+ *	Date:		10/19/2026 1:17:45 PM
+ *	Author:		Vo, Dinh Tue Minh
+ *	Purpose:	Implementation of a wait-free single-producer single-consumer ring buffer with batch operations
+ */
+
+#pragma once
+
+#ifndef _EXPERIMENTAL_SPSC_QUEUE_HPP_
+#define _EXPERIMENTAL_SPSC_QUEUE_HPP_
+
+#include "../experimental_alias_declarations.hpp"
+#include "../experimental_concurrency.hpp"
+
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace experimental {
+	/*	SPSCQueue ADT class
+		provides a FIFO ring buffer of a fixed capacity, a power of 2, between one producer thread
+		and one consumer thread. The producer only writes the tail and the consumer only writes the head,
+		so neither needs a compare-and-swap: every operation ends with one release store.
+		- Each side keeps a cached copy of the other side's index on its own cache line, and reloads
+		  the shared index only when the cached one says the ring is full or empty,
+		  so the two cores do not bounce a cache line on every element.
+		- push_n() and pop_n() move a batch with a single index update, copying the contiguous span
+		  with two memcpy around the end of the ring for trivially copyable elements.
+		Note:
+		- Only one thread may push and only one thread may pop at a time.
+	*/
+	template<typename T>
+	class SPSCQueue {
+	public:
+		using value_type = T;
+		using size_type = alias::size_type;
+
+		/* The Big-Five */
+		// ===============================================================================
+
+		~SPSCQueue() {
+			size_type tail = tail_.load(std::memory_order_relaxed);
+			for (size_type pos = head_.load(std::memory_order_relaxed); pos != tail; ++pos) {
+				slots_[pos & mask_].~T();
+			}
+			::operator delete(static_cast<void *>(slots_), std::align_val_t{ alignof(T) });
+		}
+
+		// create a queue of 'capacity' elements, rounded up to a power of 2
+		explicit SPSCQueue(size_type capacity)
+			: mask_{ round_up_power_of_2(capacity) - 1 },
+			slots_{ static_cast<T *>(::operator new((mask_ + 1) * sizeof(T), std::align_val_t{ alignof(T) })) } {}
+
+		SPSCQueue(SPSCQueue const &) = delete;
+		SPSCQueue& operator=(SPSCQueue const &) = delete;
+
+		/* Capacity operations */
+		// ===============================================================================
+
+		// query the capacity of the queue
+		size_type capacity() const noexcept {
+			return mask_ + 1;
+		}
+
+		// get an estimate of the number of elements, exact when called by the producer or the consumer
+		// between their own operations and the other side is idle
+		size_type size_approx() const noexcept {
+			size_type head = head_.load(std::memory_order_acquire);
+			size_type tail = tail_.load(std::memory_order_acquire);
+			return tail > head ? tail - head : 0;
+		}
+
+		bool empty() const noexcept {
+			return size_approx() == 0;
+		}
+
+		/* Producer operations */
+		// ===============================================================================
+
+		// construct an element from 'args' at the back of the queue
+		// return false if the queue is full
+		template<typename... Args>
+		bool try_emplace(Args &&...args) {
+			size_type tail = tail_.load(std::memory_order_relaxed);
+			if (tail - cachedHead_ > mask_) {
+				cachedHead_ = head_.load(std::memory_order_acquire);
+				if (tail - cachedHead_ > mask_) {
+					return false;
+				}
+			}
+			::new (static_cast<void *>(slots_ + (tail & mask_))) T(std::forward<Args>(args)...);
+			tail_.store(tail + 1, std::memory_order_release);
+			return true;
+		}
+		bool try_push(T const &item) {
+			return try_emplace(item);
+		}
+		bool try_push(T &&item) {
+			return try_emplace(std::move(item));
+		}
+
+		// add 'item' to the back of the queue, wait while the queue is full
+		void push(T const &item) {
+			for (Backoff backoff; !try_push(item); backoff.pause());
+		}
+		void push(T &&item) {
+			for (Backoff backoff; !try_push(std::move(item)); backoff.pause());
+		}
+
+		// copy up to 'n' elements from 'items' to the back of the queue
+		// return the number of elements pushed, less than 'n' if the queue gets full
+		size_type push_n(T const *items, size_type n) {
+			size_type tail = tail_.load(std::memory_order_relaxed);
+			size_type free = capacity() - (tail - cachedHead_);
+			if (free < n) {
+				cachedHead_ = head_.load(std::memory_order_acquire);
+				free = capacity() - (tail - cachedHead_);
+			}
+			size_type count = n < free ? n : free;
+			size_type first = tail & mask_;
+			size_type firstPart = count < capacity() - first ? count : capacity() - first;
+			copy_to_ring(items, slots_ + first, firstPart);
+			copy_to_ring(items + firstPart, slots_, count - firstPart);
+			tail_.store(tail + count, std::memory_order_release);
+			return count;
+		}
+
+		/* Consumer operations */
+		// ===============================================================================
+
+		// move the front element to 'item' and remove it
+		// return false if the queue is empty
+		bool try_pop(T &item) {
+			size_type head = head_.load(std::memory_order_relaxed);
+			if (head == cachedTail_) {
+				cachedTail_ = tail_.load(std::memory_order_acquire);
+				if (head == cachedTail_) {
+					return false;
+				}
+			}
+			T *p = slots_ + (head & mask_);
+			item = std::move(*p);
+			p->~T();
+			head_.store(head + 1, std::memory_order_release);
+			return true;
+		}
+
+		// remove the front element, wait while the queue is empty
+		T pop() {
+			T item;
+			for (Backoff backoff; !try_pop(item); backoff.pause());
+			return item;
+		}
+
+		// move up to 'n' elements from the front of the queue to 'items' and remove them
+		// return the number of elements popped, less than 'n' if the queue gets empty
+		size_type pop_n(T *items, size_type n) {
+			size_type head = head_.load(std::memory_order_relaxed);
+			size_type available = cachedTail_ - head;
+			if (available < n) {
+				cachedTail_ = tail_.load(std::memory_order_acquire);
+				available = cachedTail_ - head;
+			}
+			size_type count = n < available ? n : available;
+			size_type first = head & mask_;
+			size_type firstPart = count < capacity() - first ? count : capacity() - first;
+			move_from_ring(slots_ + first, items, firstPart);
+			move_from_ring(slots_, items + firstPart, count - firstPart);
+			head_.store(head + count, std::memory_order_release);
+			return count;
+		}
+
+	private:
+		// read-only after construction, shared by both sides
+		size_type const mask_;
+		T *const slots_;
+		// written by the producer
+		alignas(CACHE_LINE_SIZE) std::atomic<size_type> tail_{ 0 };
+		size_type cachedHead_ = 0;
+		// written by the consumer
+		alignas(CACHE_LINE_SIZE) std::atomic<size_type> head_{ 0 };
+		size_type cachedTail_ = 0;
+
+		// construct 'n' copies of 'from' in the free slots at 'to'
+		static void copy_to_ring(T const *from, T *to, size_type n) {
+			if constexpr (std::is_trivially_copyable<T>::value) {
+				if (n > 0) {
+					std::memcpy(static_cast<void *>(to), from, n * sizeof(T));
+				}
+			}
+			else {
+				std::uninitialized_copy(from, from + n, to);
+			}
+		}
+
+		// move 'n' elements from the slots at 'from' to 'to', leaving the slots free
+		static void move_from_ring(T *from, T *to, size_type n) {
+			if constexpr (std::is_trivially_copyable<T>::value) {
+				if (n > 0) {
+					std::memcpy(static_cast<void *>(to), from, n * sizeof(T));
+				}
+			}
+			else {
+				for (size_type i = 0; i < n; ++i) {
+					to[i] = std::move(from[i]);
+					from[i].~T();
+				}
+			}
+		}
+
+		static size_type round_up_power_of_2(size_type n) {
+			if (n < 2) {
+				return 2;
+			}
+			size_type p = 1;
+			while (p < n) {
+				p <<= 1;
+			}
+			return p;
+		}
+	};
+}
+
+#endif // !_EXPERIMENTAL_SPSC_QUEUE_HPP_
@@ -10,16 +10,21 @@
 #ifndef _EXPERIMENTAL_STACK_HPP_
 #define _EXPERIMENTAL_STACK_HPP_
 
-#include "experimental_list.hpp"
+#include "experimental_vector.hpp"
 
+#include <new>
+#include <type_traits>
 #include <utility>
 #include <cassert>
 
 namespace experimental {
 	/*  Stack ADT class
 		provide a generic container that support LIFO data structure
+		Note:
+		- The default container is a Vector: push and pop move the end of a contiguous array
+		  and allocate only when the capacity grows, unlike a List which allocates a node per push.
 	*/
-	template<typename T, typename Container = List<T>>
+	template<typename T, typename Container = Vector<T>>
 	class Stack {
 	public:
 		using container_type = Container;
@@ -70,6 +75,12 @@ namespace experimental {
 			container_.push_back(std::move(value));
 		}
 
+		// construct an element from 'args' at the top of the stack
+		template<typename... Args>
+		void emplace(Args &&...args) {
+			container_.emplace_back(std::forward<Args>(args)...);
+		}
+
 		// remove element at the top of the stack
 		// do not check if the stack is empty
 		void pop() {
@@ -81,6 +92,170 @@ namespace experimental {
 	private:
 		Container container_;
 	};
+
+	/*	StaticStack ADT class
+		provide a LIFO stack of at most N elements stored inline, inside the object:
+		push and pop only move the top index, nothing is allocated.
+		Suited to explicit stacks replacing a recursion whose depth is bounded, as in a quick sort
+		that pushes the larger part and loops on the smaller one (depth at most log2 of the size).
+		Note:
+		- Pushing to a full stack is not checked, as popping from an empty one.
+	*/
+	template<typename T, alias::size_type N>
+	class StaticStack {
+	public:
+		using value_type = T;
+		using reference = T&;
+		using const_reference = T const &;
+		using size_type = alias::size_type;
+
+		static_assert(N > 0, "the capacity must not be 0");
+
+		/* The Big-Five */
+		// ===============================================================================
+		~StaticStack() {
+			clear();
+		}
+
+		StaticStack() noexcept = default;
+
+		StaticStack(StaticStack const &s) {
+			push_elements(s);
+		}
+
+		StaticStack(StaticStack &&s) noexcept(std::is_nothrow_move_constructible<T>::value) {
+			push_elements(s);
+			s.clear();
+		}
+
+		StaticStack& operator=(StaticStack const &rhs) {
+			if (this != &rhs) {
+				clear();
+				for (size_type i = 0; i < rhs.size_; ++i) {
+					push(rhs.element(i));
+				}
+			}
+			return *this;
+		}
+
+		StaticStack& operator=(StaticStack &&rhs) noexcept(std::is_nothrow_move_constructible<T>::value) {
+			if (this != &rhs) {
+				clear();
+				for (size_type i = 0; i < rhs.size_; ++i) {
+					push(std::move(rhs.element(i)));
+				}
+				rhs.clear();
+			}
+			return *this;
+		}
+
+		/* Element access */
+		// ===============================================================================
+
+		// access the top element of the stack
+		// do not check if the stack is empty
+		reference top() {
+			assert(size_ > 0 && "cannot get top element from an empty stack");
+
+			return element(size_ - 1);
+		}
+		const_reference top() const {
+			assert(size_ > 0 && "cannot get top element from an empty stack");
+
+			return element(size_ - 1);
+		}
+
+		/* Capacity operations */
+		// ===============================================================================
+
+		// check if the stack is empty
+		bool empty() const noexcept {
+			return size_ == 0;
+		}
+
+		// check if the stack is full
+		bool full() const noexcept {
+			return size_ == N;
+		}
+
+		// query the size of the stack
+		size_type size() const noexcept {
+			return size_;
+		}
+
+		// query the maximum number of elements
+		static constexpr size_type capacity() noexcept {
+			return N;
+		}
+
+		/* Modifying operations */
+		// ===============================================================================
+
+		// insert element at the top of the stack
+		// do not check if the stack is full
+		void push(value_type const &value) {
+			emplace(value);
+		}
+		void push(value_type &&value) {
+			emplace(std::move(value));
+		}
+
+		// construct an element from 'args' at the top of the stack
+		// do not check if the stack is full
+		template<typename... Args>
+		void emplace(Args &&...args) {
+			assert(size_ < N && "cannot push to a full stack");
+
+			::new (static_cast<void *>(&storage_[size_])) T(std::forward<Args>(args)...);
+			++size_;
+		}
+
+		// remove element at the top of the stack
+		// do not check if the stack is empty
+		void pop() {
+			assert(size_ > 0 && "cannot pop from an empty stack");
+
+			element(--size_).~T();
+		}
+
+		// remove all elements
+		void clear() noexcept {
+			while (size_ > 0) {
+				element(--size_).~T();
+			}
+		}
+
+	private:
+		std::aligned_storage_t<sizeof(T), alignof(T)> storage_[N];
+		size_type size_ = 0;
+
+		T& element(size_type i) noexcept {
+			return *std::launder(reinterpret_cast<T *>(&storage_[i]));
+		}
+		T const & element(size_type i) const noexcept {
+			return *std::launder(reinterpret_cast<T const *>(&storage_[i]));
+		}
+
+		// push the elements of 's', copied if it is const and moved otherwise,
+		// and destroy the pushed ones if one throws: the destructor does not run for a stack whose constructor throws
+		template<typename Source>
+		void push_elements(Source &s) {
+			try {
+				for (size_type i = 0; i < s.size_; ++i) {
+					if constexpr (std::is_const<Source>::value) {
+						push(s.element(i));
+					}
+					else {
+						push(std::move(s.element(i)));
+					}
+				}
+			}
+			catch (...) {
+				clear();
+				throw;
+			}
+		}
+	};
 }
 
 #endif // !_EXPERIMENTAL_STACK_HPP_
@@ -0,0 +1,851 @@
+/*
+ *	File name:	"experimental_unrolled_list.hpp"
+ *	Date:		10/19/2026 5:03:51 AM
+ *	Author:		Vo, Dinh Tue Minh
+ *	Purpose:	Implementation of unrolled list ADT:
+ *				a doubly linked list of blocks which hold several elements each
+ */
+
+#pragma once
+
+#ifndef _EXPERIMENTAL_UNROLLED_LIST_HPP_
+#define _EXPERIMENTAL_UNROLLED_LIST_HPP_
+
+#include "../experimental_alias_declarations.hpp"
+#include "../experimental_allocators.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <utility>
+
+#ifdef _UNROLLED_LIST_UNINITIALIZED_ITERATOR_ASSERT_
+#undef _UNROLLED_LIST_UNINITIALIZED_ITERATOR_ASSERT_
+#endif
+// assert if iterator is uninitialized
+#define _UNROLLED_LIST_UNINITIALIZED_ITERATOR_ASSERT_(it) assert((it).pList_ != nullptr && "iterator is not initialized")
+
+namespace experimental {
+	namespace details {
+		// get the number of elements of a block of an unrolled list:
+		// as many as fit in 'BlockBytes' after the two links and the count, at least 1
+		template<typename T, alias::size_type BlockBytes>
+		constexpr alias::size_type unrolled_block_length() noexcept {
+			constexpr alias::size_type header = 2 * sizeof(void *) + sizeof(alias::size_type);
+			return BlockBytes >= header + 2 * sizeof(T) ? (BlockBytes - header) / sizeof(T) : 1;
+		}
+	}
+
+	/*	UnrolledList ADT class
+		provides a sequence container which is a doubly linked list of blocks,
+		each block storing up to BLOCK_SIZE elements contiguously, as many as fit in 'BlockBytes' with its links.
+		A scan loads one block header per BLOCK_SIZE elements, so it runs close to the speed of Vector,
+		while an insertion or a removal in the middle moves at most BLOCK_SIZE elements.
+		- Inserting into a full block splits it in two halves, except at its front or its back
+		  where a new block is linked instead, so that pushing at the ends fills whole blocks.
+		- Erasing from a block less than a quarter full merges the next block into it,
+		  if both fit in three quarters of a block.
+		- It has the interface of List, with splice(), merge() and sort(): a whole list is spliced
+		  by relinking its blocks, merging and sorting move the elements into new full blocks.
+		Note:
+		- Inserting and erasing invalidate the iterators and references to the elements of the blocks involved
+		  and the end iterator, the other blocks are not touched.
+		- Elements are moved within and between blocks, their move operations should not throw.
+	*/
+	template<typename T, alias::size_type BlockBytes = 256, typename Allocator = experimental::Allocator<T>>
+	class UnrolledList {
+	public:
+		// number of elements of a block
+		static constexpr alias::size_type BLOCK_SIZE = details::unrolled_block_length<T, BlockBytes>();
+
+	private:
+		/*	Block class
+			a node of the list which holds 'count' elements, constructed in the front of its storage
+		*/
+		struct Block {
+			Block *prev_;
+			Block *next_;
+			alias::size_type count_;
+			alignas(T) unsigned char storage_[BLOCK_SIZE * sizeof(T)];
+
+			T* elements() noexcept {
+				return std::launder(reinterpret_cast<T *>(storage_));
+			}
+		};
+
+		using alloc_traits = std::allocator_traits<Allocator>;
+		using block_allocator_type = typename alloc_traits::template rebind_alloc<Block>;
+		using block_traits = std::allocator_traits<block_allocator_type>;
+
+		/*	ConstIterator class
+			points to an element by its block and its index in the block,
+			the end iterator has no block
+		*/
+		class ConstIterator {
+		public:
+			using value_type = T;
+			using reference = value_type const &;
+			using pointer = value_type const *;
+			using difference_type = alias::pointer_difference_type;
+			using iterator_category = std::bidirectional_iterator_tag;
+
+			// Default constructor
+			ConstIterator() = delete;
+
+			/* Operator overloadings */
+			// ======================================================================
+
+			// dereference operator
+			reference operator*() const {
+				return retrieve();
+			}
+			pointer operator->() const {
+				return &retrieve();
+			}
+			// prefix increment operator
+			ConstIterator& operator++() {
+				increment();
+				return *this;
+			}
+			// postfix increment operator
+			ConstIterator operator++(int) {
+				ConstIterator old = *this;
+				increment();
+				return old;
+			}
+			// prefix decrement operator
+			ConstIterator& operator--() {
+				decrement();
+				return *this;
+			}
+			// postfix decrement operator
+			ConstIterator operator--(int) {
+				ConstIterator old = *this;
+				decrement();
+				return old;
+			}
+			// equal operator
+			bool operator==(ConstIterator const &rhs) const {
+				_UNROLLED_LIST_UNINITIALIZED_ITERATOR_ASSERT_(*this);
+				_UNROLLED_LIST_UNINITIALIZED_ITERATOR_ASSERT_(rhs);
+				assert(pList_ == rhs.pList_ && "compare mismatched iterators");
+				return pBlock_ == rhs.pBlock_ && index_ == rhs.index_;
+			}
+			// not equal operator
+			bool operator!=(ConstIterator const &rhs) const {
+				return !(*this == rhs);
+			}
+
+		protected:
+			UnrolledList const *pList_;
+			Block *pBlock_;
+			alias::size_type index_;
+
+			ConstIterator(UnrolledList const *pList, Block *pBlock, alias::size_type index) noexcept
+				: pList_{ pList }, pBlock_{ pBlock }, index_{ index } {}
+
+			// retrieve data of the current iterator
+			value_type& retrieve() const {
+				_UNROLLED_LIST_UNINITIALIZED_ITERATOR_ASSERT_(*this);
+				assert(pBlock_ != nullptr && "cannot dereference pass-the-end");
+				return pBlock_->elements()[index_];
+			}
+
+			void increment() {
+				_UNROLLED_LIST_UNINITIALIZED_ITERATOR_ASSERT_(*this);
+				assert(pBlock_ != nullptr && "cannot increment pass the end");
+				if (++index_ == pBlock_->count_) {
+					pBlock_ = pBlock_->next_;
+					index_ = 0;
+				}
+			}
+
+			void decrement() {
+				_UNROLLED_LIST_UNINITIALIZED_ITERATOR_ASSERT_(*this);
+				if (index_ == 0) {
+					pBlock_ = pBlock_ ? pBlock_->prev_ : pList_->tail_;
+					assert(pBlock_ != nullptr && "cannot decrement pass the head");
+					index_ = pBlock_->count_;
+				}
+				--index_;
+			}
+
+			/* Friend classes */
+			// ======================================================================
+			friend class UnrolledList;
+		};
+
+		/*	Iterator class
+			inherit from ConstIterator class
+			point to non-const
+		*/
+		class Iterator : public ConstIterator {
+		public:
+			using value_type = typename ConstIterator::value_type;
+			using reference = value_type &;
+			using pointer = value_type *;
+			using difference_type = typename ConstIterator::difference_type;
+			using iterator_category = typename ConstIterator::iterator_category;
+
+			// Default constructor
+			Iterator() = delete;
+
+			/* Operator overloadings */
+			// ======================================================================
+
+			// dereference operator
+			reference operator*() const {
+				return ConstIterator::retrieve();
+			}
+			pointer operator->() const {
+				return &ConstIterator::retrieve();
+			}
+			// prefix increment operator
+			Iterator& operator++() {
+				ConstIterator::increment();
+				return *this;
+			}
+			// postfix increment operator
+			Iterator operator++(int) {
+				Iterator old = *this;
+				ConstIterator::increment();
+				return old;
+			}
+			// prefix decrement operator
+			Iterator& operator--() {
+				ConstIterator::decrement();
+				return *this;
+			}
+			// postfix decrement operator
+			Iterator operator--(int) {
+				Iterator old = *this;
+				ConstIterator::decrement();
+				return old;
+			}
+
+		protected:
+			Iterator(UnrolledList const *pList, Block *pBlock, alias::size_type index) noexcept
+				: ConstIterator{ pList, pBlock, index } {}
+
+			/* Friend classes */
+			// ======================================================================
+			friend class UnrolledList;
+		};
+
+	public:
+		using size_type = alias::size_type;
+		using value_type = T;
+		using reference = value_type &;
+		using const_reference = value_type const &;
+		using allocator_type = Allocator;
+		using iterator = Iterator;
+		using const_iterator = ConstIterator;
+
+		/* The Big-Five */
+		// ======================================================================
+
+		~UnrolledList() {
+			clear();
+		}
+
+		UnrolledList()
+			: UnrolledList(allocator_type()) {}
+
+		explicit UnrolledList(allocator_type const &a)
+			: allocator_(a), head_{ nullptr }, tail_{ nullptr }, size_{ 0 }, blockCount_{ 0 } {}
+
+		UnrolledList(UnrolledList const &l)
+			: UnrolledList(alloc_traits::select_on_container_copy_construction(l.allocator_)) {
+			for (auto const &e : l) {
+				push_back(e);
+			}
+		}
+
+		// the blocks are taken over, no element is moved
+		UnrolledList(UnrolledList &&l) noexcept
+			: allocator_(l.allocator_), head_{ l.head_ }, tail_{ l.tail_ }, size_{ l.size_ }, blockCount_{ l.blockCount_ } {
+			l.head_ = l.tail_ = nullptr;
+			l.size_ = l.blockCount_ = 0;
+		}
+
+		UnrolledList& operator=(UnrolledList const &rhs) {
+			if (this != &rhs) {
+				// the blocks are released by the allocator that got them before it is replaced
+				clear();
+				if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+					allocator_ = rhs.allocator_;
+				}
+				for (auto const &e : rhs) {
+					push_back(e);
+				}
+			}
+			return *this;
+		}
+
+		// the blocks of 'rhs' are taken over if the allocator propagates or both allocators are equal,
+		// otherwise the elements are moved one by one
+		UnrolledList& operator=(UnrolledList &&rhs) noexcept(alloc_traits::propagate_on_container_move_assignment::value
+															 || alloc_traits::is_always_equal::value) {
+			if (this == &rhs) {
+				return *this;
+			}
+			clear();
+			if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+				allocator_ = rhs.allocator_;
+			}
+			else if (allocator_ != rhs.allocator_) {
+				// the blocks of 'rhs' cannot be taken over: move the elements one by one
+				for (auto &e : rhs) {
+					push_back(std::move(e));
+				}
+				rhs.clear();
+				return *this;
+			}
+			head_ = rhs.head_;
+			tail_ = rhs.tail_;
+			size_ = rhs.size_;
+			blockCount_ = rhs.blockCount_;
+			rhs.head_ = rhs.tail_ = nullptr;
+			rhs.size_ = rhs.blockCount_ = 0;
+			return *this;
+		}
+
+		/* Custom constructor */
+		// ======================================================================
+
+		explicit UnrolledList(std::initializer_list<T> const &ul, allocator_type const &a = allocator_type())
+			: UnrolledList(a) {
+			for (auto const &e : ul) {
+				push_back(e);
+			}
+		}
+
+		// get a copy of the allocator
+		allocator_type get_allocator() const {
+			return allocator_;
+		}
+
+		/* Element access */
+		// ======================================================================
+
+		// access the first element of the list
+		// do not check if the list is empty
+		reference front() {
+			return head_->elements()[0];
+		}
+		const_reference front() const {
+			return head_->elements()[0];
+		}
+		// access the last element of the list
+		// do not check if the list is empty
+		reference back() {
+			return tail_->elements()[tail_->count_ - 1];
+		}
+		const_reference back() const {
+			return tail_->elements()[tail_->count_ - 1];
+		}
+
+		/* Capacity operations */
+		// ======================================================================
+
+		// query the size of the list
+		size_type size() const {
+			return size_;
+		}
+		// check if the list is empty
+		bool empty() const {
+			return size() == 0;
+		}
+		// query the number of blocks
+		size_type block_count() const {
+			return blockCount_;
+		}
+
+		/* Modifying operations */
+		// ======================================================================
+
+		// insert item before the iterator it
+		// return the iterator that points to the new item in the list
+		iterator insert(const_iterator it, value_type const &item) {
+			return insert_at(it, item);
+		}
+		iterator insert(const_iterator it, value_type &&item) {
+			return insert_at(it, std::move(item));
+		}
+		// construct an element from 'args' before the iterator it
+		// return the iterator that points to the new element in the list
+		template<typename... Args>
+		iterator emplace(const_iterator it, Args &&...args) {
+			return insert_at(it, std::forward<Args>(args)...);
+		}
+		// remove the element pointed by the iterator from the list
+		// return the iterator that points to the next element of the list
+		iterator erase(const_iterator it) {
+			_UNROLLED_LIST_UNINITIALIZED_ITERATOR_ASSERT_(it);
+			assert(it.pList_ == this && "cannot erase iterator from different lists");
+			assert(it.pBlock_ != nullptr && "cannot erase pass-the-end");
+
+			Block *b = it.pBlock_;
+			size_type i = it.index_;
+			T *p = b->elements();
+			for (size_type k = i + 1; k < b->count_; ++k) {
+				p[k - 1] = std::move(p[k]);
+			}
+			alloc_traits::destroy(allocator_, p + --b->count_);
+			--size_;
+			if (b->count_ == 0) {
+				Block *next = b->next_;
+				free_block(b);
+				return iterator(this, next, 0);
+			}
+			if (b->count_ < BLOCK_SIZE / 4 && b->next_ && b->count_ + b->next_->count_ <= BLOCK_SIZE * 3 / 4) {
+				merge_next(b);
+			}
+			return i < b->count_ ? iterator(this, b, i) : iterator(this, b->next_, 0);
+		}
+		// remove elements from 'from' to, but not include, 'to' [from, to) from the list
+		// return the iterator that points to the element 'to' pointed to
+		iterator erase(const_iterator from, const_iterator to) {
+			_UNROLLED_LIST_UNINITIALIZED_ITERATOR_ASSERT_(from);
+			_UNROLLED_LIST_UNINITIALIZED_ITERATOR_ASSERT_(to);
+			assert(from.pList_ == this && to.pList_ == this && "cannot erase iterators from different lists");
+
+			// 'to' is invalidated by the erasures in its block, count the elements instead
+			size_type n = 0;
+			for (const_iterator it = from; it != to; ++it) {
+				++n;
+			}
+			iterator it(this, from.pBlock_, from.index_);
+			if (n == size_) {
+				clear();
+				return end();
+			}
+			for (; n > 0; --n) {
+				it = erase(it);
+			}
+			return it;
+		}
+
+		// add item to the front of the list
+		void push_front(value_type const &item) {
+			insert(begin(), item);
+		}
+		void push_front(value_type &&item) {
+			insert(begin(), std::move(item));
+		}
+		// add item to the back of the list
+		void push_back(value_type const &item) {
+			insert(end(), item);
+		}
+		void push_back(value_type &&item) {
+			insert(end(), std::move(item));
+		}
+		// construct an element from 'args' in the front of the list
+		template<typename... Args>
+		reference emplace_front(Args &&...args) {
+			return *insert_at(begin(), std::forward<Args>(args)...);
+		}
+		// construct an element from 'args' in the back of the list
+		template<typename... Args>
+		reference emplace_back(Args &&...args) {
+			return *insert_at(end(), std::forward<Args>(args)...);
+		}
+		// remove the first element of the list
+		// do not check if the list is empty
+		void pop_front() {
+			erase(begin());
+		}
+		// remove the last element of the list
+		// do not check if the list is empty
+		void pop_back() {
+			erase(iterator(this, tail_, tail_->count_ - 1));
+		}
+		// remove all the elements of the list and release the blocks
+		void clear() noexcept {
+			while (head_) {
+				Block *next = head_->next_;
+				T *p = head_->elements();
+				for (size_type k = 0; k < head_->count_; ++k) {
+					alloc_traits::destroy(allocator_, p + k);
+				}
+				deallocate_block(head_);
+				head_ = next;
+			}
+			tail_ = nullptr;
+			size_ = blockCount_ = 0;
+		}
+
+		// the allocators are exchanged only if they propagate on swap, otherwise they must be equal
+		void swap(UnrolledList &other) noexcept {
+			using std::swap;
+			if constexpr (alloc_traits::propagate_on_container_swap::value) {
+				swap(allocator_, other.allocator_);
+			}
+			else {
+				assert(allocator_ == other.allocator_ && "cannot swap lists with unequal allocators");
+			}
+			swap(head_, other.head_);
+			swap(tail_, other.tail_);
+			swap(size_, other.size_);
+			swap(blockCount_, other.blockCount_);
+		}
+
+		/* List operations */
+		// ======================================================================
+		// A whole list is spliced by relinking its blocks, splitting at most the block of 'pos'.
+		// Other elements are moved between blocks: merge() and sort() build new blocks
+		// and part of a list is spliced by moving its elements.
+		// The blocks taken from 'other' must be released by the allocator of this list,
+		// so both allocators must compare equal.
+		// Iterators to the elements of both lists are invalidated.
+
+		// move all the elements of 'other' before 'pos'
+		void splice(iterator pos, UnrolledList &other) {
+			_UNROLLED_LIST_UNINITIALIZED_ITERATOR_ASSERT_(pos);
+			assert(pos.pList_ == this && "cannot splice into different lists");
+			assert(&other != this && "cannot splice a list into itself");
+			assert(allocator_ == other.allocator_ && "cannot splice lists with unequal allocators");
+
+			if (other.empty()) {
+				return;
+			}
+			Block *next = pos.pBlock_;
+			if (next && pos.index_ > 0) {
+				// the elements from 'pos' go to a new block, the blocks of 'other' are linked before it
+				Block *upper = link_block(next, next->next_);
+				move_elements(next, pos.index_, upper);
+				next = upper;
+			}
+			Block *prev = next ? next->prev_ : tail_;
+			other.head_->prev_ = prev;
+			other.tail_->next_ = next;
+			(prev ? prev->next_ : head_) = other.head_;
+			(next ? next->prev_ : tail_) = other.tail_;
+			size_ += other.size_;
+			blockCount_ += other.blockCount_;
+			other.head_ = other.tail_ = nullptr;
+			other.size_ = other.blockCount_ = 0;
+		}
+		void splice(iterator pos, UnrolledList &&other) {
+			splice(pos, other);
+		}
+		// move the element pointed by 'it' in 'other' before 'pos'
+		void splice(iterator pos, UnrolledList &other, iterator it) {
+			_UNROLLED_LIST_UNINITIALIZED_ITERATOR_ASSERT_(it);
+			assert(it.pList_ == &other && "iterator is not in the list spliced from");
+			assert(it.pBlock_ != nullptr && "cannot splice pass-the-end");
+
+			iterator next = it;
+			splice(pos, other, it, ++next);
+		}
+		// move the elements [first, last) of 'other' before 'pos', 'pos' must not be in [first, last)
+		// the whole of another list is relinked, otherwise the elements are moved
+		// into new blocks which are then relinked
+		void splice(iterator pos, UnrolledList &other, iterator first, iterator last) {
+			_UNROLLED_LIST_UNINITIALIZED_ITERATOR_ASSERT_(pos);
+			_UNROLLED_LIST_UNINITIALIZED_ITERATOR_ASSERT_(first);
+			_UNROLLED_LIST_UNINITIALIZED_ITERATOR_ASSERT_(last);
+			assert(pos.pList_ == this && "cannot splice into different lists");
+			assert(first.pList_ == &other && last.pList_ == &other && "iterators are not in the list spliced from");
+			assert(allocator_ == other.allocator_ && "cannot splice lists with unequal allocators");
+
+			if (first == last) {
+				return;
+			}
+			if (&other != this && first == other.begin() && last == other.end()) {
+				splice(pos, other);
+				return;
+			}
+			// erasing the range invalidates 'pos' if it is in the same list, find it again by its index
+			size_type index = &other == this ? index_of(pos) : 0;
+			UnrolledList moved(allocator_);
+			for (iterator it = first; it != last; ++it) {
+				moved.push_back(std::move(*it));
+			}
+			if (&other == this && index > index_of(first)) {
+				index -= moved.size();
+			}
+			other.erase(first, last);
+			splice(&other == this ? iterator_at(index) : pos, moved);
+		}
+
+		// merge the sorted list 'other' into this sorted list, 'other' becomes empty
+		// stable: of equal elements, those of this list come first
+		// if all the elements of one list go before those of the other, the blocks are relinked,
+		// otherwise the elements are moved to new blocks
+		// precondition: 'cmp' does not throw
+		template<typename Compare>
+		void merge(UnrolledList &other, Compare cmp) {
+			assert(allocator_ == other.allocator_ && "cannot merge lists with unequal allocators");
+
+			if (&other == this || other.empty()) {
+				return;
+			}
+			if (empty() || !cmp(other.front(), back())) {
+				splice(end(), other);
+				return;
+			}
+			if (cmp(other.back(), front())) {
+				splice(begin(), other);
+				return;
+			}
+			UnrolledList merged(allocator_);
+			iterator it1 = begin();
+			iterator it2 = other.begin();
+			while (it1 != end() && it2 != other.end()) {
+				if (cmp(*it2, *it1)) {
+					merged.push_back(std::move(*it2++));
+				}
+				else {
+					merged.push_back(std::move(*it1++));
+				}
+			}
+			for (; it1 != end(); ++it1) {
+				merged.push_back(std::move(*it1));
+			}
+			for (; it2 != other.end(); ++it2) {
+				merged.push_back(std::move(*it2));
+			}
+			other.clear();
+			clear();
+			swap(merged);
+		}
+		void merge(UnrolledList &other) {
+			merge(other, std::less<value_type>());
+		}
+		template<typename Compare>
+		void merge(UnrolledList &&other, Compare cmp) {
+			merge(other, cmp);
+		}
+		void merge(UnrolledList &&other) {
+			merge(other);
+		}
+
+		// sort the list with a top-down merge sort of its blocks:
+		// the elements of a block are sorted in place, then the halves of the list are merged
+		// stable, O(n log(n)) comparisons, the merges move the elements O(log(n / BLOCK_SIZE)) times
+		// precondition: 'cmp' does not throw
+		template<typename Compare>
+		void sort(Compare cmp) {
+			if (blockCount_ == 0) {
+				return;
+			}
+			if (blockCount_ == 1) {
+				std::stable_sort(head_->elements(), head_->elements() + head_->count_, cmp);
+				return;
+			}
+			// move the second half of the blocks to 'upper'
+			Block *b = head_;
+			size_type lowerSize = 0;
+			for (size_type k = blockCount_ / 2; k > 0; --k, b = b->next_) {
+				lowerSize += b->count_;
+			}
+			UnrolledList upper(allocator_);
+			upper.head_ = b;
+			upper.tail_ = tail_;
+			upper.size_ = size_ - lowerSize;
+			upper.blockCount_ = blockCount_ - blockCount_ / 2;
+			tail_ = b->prev_;
+			tail_->next_ = nullptr;
+			b->prev_ = nullptr;
+			size_ = lowerSize;
+			blockCount_ /= 2;
+			sort(cmp);
+			upper.sort(cmp);
+			merge(upper, cmp);
+		}
+		void sort() {
+			sort(std::less<value_type>());
+		}
+
+		/* Iterator operations */
+		// ======================================================================
+
+		// get the iterator pointing to the first element of the list
+		iterator begin() {
+			return iterator{ this, head_, 0 };
+		}
+		const_iterator begin() const {
+			return const_iterator{ this, head_, 0 };
+		}
+		const_iterator cbegin() const {
+			return begin();
+		}
+		// get the iterator pointing to the pass-the-last-element of the list
+		iterator end() {
+			return iterator{ this, nullptr, 0 };
+		}
+		const_iterator end() const {
+			return const_iterator{ this, nullptr, 0 };
+		}
+		const_iterator cend() const {
+			return end();
+		}
+
+	private:
+		allocator_type allocator_;
+		Block *head_;
+		Block *tail_;
+		size_type size_;
+		size_type blockCount_;
+
+		// construct an element from 'args' before 'it'
+		template<typename... Args>
+		iterator insert_at(const_iterator it, Args &&...args) {
+			_UNROLLED_LIST_UNINITIALIZED_ITERATOR_ASSERT_(it);
+			assert(it.pList_ == this && "cannot insert into different lists");
+
+			Block *b = it.pBlock_;
+			size_type i = it.index_;
+			if (!b) {
+				b = tail_;
+				i = b ? b->count_ : 0;
+			}
+			else if (i == 0 && b->prev_ && b->prev_->count_ < BLOCK_SIZE) {
+				// append to the previous block rather than shift this one
+				b = b->prev_;
+				i = b->count_;
+			}
+			if (!b || b->count_ == BLOCK_SIZE) {
+				if (!b || i == b->count_) {
+					b = link_block(b, b ? b->next_ : head_);
+					i = 0;
+				}
+				else if (i == 0) {
+					b = link_block(b->prev_, b);
+				}
+				else {
+					// 'args' may refer to an element of the upper half, which the split moves:
+					// build the element first
+					value_type item(std::forward<Args>(args)...);
+					Block *upper = split(b);
+					if (i > b->count_) {
+						i -= b->count_;
+						b = upper;
+					}
+					return construct_in_block(b, i, std::move(item));
+				}
+			}
+			return construct_in_block(b, i, std::forward<Args>(args)...);
+		}
+
+		// construct an element from 'args' at the index 'i' of the block 'b', which is not full,
+		// shifting the elements from 'i' to the back
+		template<typename... Args>
+		iterator construct_in_block(Block *b, size_type i, Args &&...args) {
+			T *p = b->elements();
+			try {
+				if (i == b->count_) {
+					alloc_traits::construct(allocator_, p + i, std::forward<Args>(args)...);
+				}
+				else {
+					value_type item(std::forward<Args>(args)...);
+					alloc_traits::construct(allocator_, p + b->count_, std::move(p[b->count_ - 1]));
+					for (size_type k = b->count_ - 1; k > i; --k) {
+						p[k] = std::move(p[k - 1]);
+					}
+					p[i] = std::move(item);
+				}
+			}
+			catch (...) {
+				if (b->count_ == 0) {
+					free_block(b);
+				}
+				throw;
+			}
+			++b->count_;
+			++size_;
+			return iterator(this, b, i);
+		}
+
+		// get the number of elements before 'it'
+		size_type index_of(const_iterator it) const noexcept {
+			size_type index = 0;
+			Block *b = head_;
+			for (; b != it.pBlock_; b = b->next_) {
+				index += b->count_;
+			}
+			return b ? index + it.index_ : index;
+		}
+
+		// get the iterator to the element at 'index', end() if 'index' is the size
+		iterator iterator_at(size_type index) noexcept {
+			Block *b = head_;
+			for (; b && index >= b->count_; b = b->next_) {
+				index -= b->count_;
+			}
+			return iterator(this, b, b ? index : 0);
+		}
+
+		// allocate an empty block and link it between 'prev' and 'next'
+		Block* link_block(Block *prev, Block *next) {
+			block_allocator_type blockAllocator(allocator_);
+			Block *b = block_traits::allocate(blockAllocator, 1);
+			::new (static_cast<void *>(b)) Block;
+			b->prev_ = prev;
+			b->next_ = next;
+			b->count_ = 0;
+			(prev ? prev->next_ : head_) = b;
+			(next ? next->prev_ : tail_) = b;
+			++blockCount_;
+			return b;
+		}
+
+		// unlink the empty block 'b' and release it
+		void free_block(Block *b) noexcept {
+			(b->prev_ ? b->prev_->next_ : head_) = b->next_;
+			(b->next_ ? b->next_->prev_ : tail_) = b->prev_;
+			--blockCount_;
+			deallocate_block(b);
+		}
+
+		void deallocate_block(Block *b) noexcept {
+			block_allocator_type blockAllocator(allocator_);
+			b->~Block();
+			block_traits::deallocate(blockAllocator, b, 1);
+		}
+
+		// move the upper half of the full block 'b' to a new block after it
+		// return the new block
+		Block* split(Block *b) {
+			Block *upper = link_block(b, b->next_);
+			size_type half = b->count_ / 2;
+			move_elements(b, half, upper);
+			return upper;
+		}
+
+		// move the elements of the block after 'b' to the back of 'b' and release that block
+		void merge_next(Block *b) noexcept {
+			Block *next = b->next_;
+			T *p = b->elements();
+			T *q = next->elements();
+			for (size_type k = 0; k < next->count_; ++k) {
+				alloc_traits::construct(allocator_, p + b->count_ + k, std::move(q[k]));
+				alloc_traits::destroy(allocator_, q + k);
+			}
+			b->count_ += next->count_;
+			next->count_ = 0;
+			free_block(next);
+		}
+
+		// move the elements of 'from' starting at 'first' to the empty block 'to'
+		void move_elements(Block *from, size_type first, Block *to) noexcept {
+			T *p = from->elements();
+			T *q = to->elements();
+			for (size_type k = first; k < from->count_; ++k) {
+				alloc_traits::construct(allocator_, q + (k - first), std::move(p[k]));
+				alloc_traits::destroy(allocator_, p + k);
+			}
+			to->count_ = from->count_ - first;
+			from->count_ = first;
+		}
+	};
+}
+
+#undef _UNROLLED_LIST_UNINITIALIZED_ITERATOR_ASSERT_
+
+#endif // !_EXPERIMENTAL_UNROLLED_LIST_HPP_
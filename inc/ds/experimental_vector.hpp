@@ -11,42 +11,115 @@
 #define _EXPERIMENTAL_VECTOR_HPP_
 
 #include "../experimental_alias_declarations.hpp"
+#include "../experimental_allocators.hpp"
+#include "../experimental_growth_policies.hpp"
+#include "../experimental_type_traits.hpp"
 
+#include <algorithm>
 #include <cassert>
+#include <cstdlib>
+#include <cstring>
 #include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
 #include <utility>
 
+// checked iterators remember their vector and assert on misuse,
+// release iterators are a plain pointer wrapper
+// default to checked iterators unless NDEBUG is defined, define it to 0 or 1 to override
+// all translation units of a program must agree on the mode
+#ifndef _EXPERIMENTAL_VECTOR_CHECKED_ITERATORS_
+#ifdef NDEBUG
+#define _EXPERIMENTAL_VECTOR_CHECKED_ITERATORS_ 0
+#else
+#define _EXPERIMENTAL_VECTOR_CHECKED_ITERATORS_ 1
+#endif
+#endif
+
 #ifdef _VECTOR_UNINITIALIZED_ITERATOR_ASSERT_
 #undef _VECTOR_UNINITIALIZED_ITERATOR_ASSERT_
 #endif
+#ifdef _VECTOR_OUT_OF_BOUND_ITERATOR_ASSERT_
+#undef _VECTOR_OUT_OF_BOUND_ITERATOR_ASSERT_
+#endif
+#ifdef _VECTOR_MISMATCHED_ITERATOR_ASSERT_
+#undef _VECTOR_MISMATCHED_ITERATOR_ASSERT_
+#endif
+#ifdef _VECTOR_DEREFERENCEABLE_ITERATOR_ASSERT_
+#undef _VECTOR_DEREFERENCEABLE_ITERATOR_ASSERT_
+#endif
+#ifdef _VECTOR_DECREMENTABLE_ITERATOR_ASSERT_
+#undef _VECTOR_DECREMENTABLE_ITERATOR_ASSERT_
+#endif
+
+#if _EXPERIMENTAL_VECTOR_CHECKED_ITERATORS_
 // assert if the iterator 'it' is not initialized
 #define _VECTOR_UNINITIALIZED_ITERATOR_ASSERT_(it) \
 			assert((it).pVector_ \
 					&& (it).pCurrent_ \
 					&& "iterator is not initialized")
 
-#ifdef _VECTOR_OUT_OF_BOUND_ITERATOR_ASSERT_
-#undef _VECTOR_OUT_OF_BOUND_ITERATOR_ASSERT_
-#endif
 // assert if the iterator 'it' is out-of-bound
 #define _VECTOR_OUT_OF_BOUND_ITERATOR_ASSERT_(it) \
 			assert((it).pCurrent_ >= (it).pVector_->elements_ \
-					&& (it).pCurrent_ <= &(it).pVector_->elements_[pVector_->size_] \
+					&& (it).pCurrent_ <= (it).pVector_->elements_ + (it).pVector_->size_ \
 					&& "out-of-bound iterator access")
 
-#ifdef _VECTOR_MISMATCHED_ITERATOR_ASSERT_
-#undef _VECTOR__MISMATCHED_ITERATOR_ASSERT_
-#endif
 // assert if two iterators are from different vector
 #define _VECTOR_MISMATCHED_ITERATOR_ASSERT_(itX, itY) \
 			assert((itX).pVector_ == (itY).pVector_ \
 					&& "cannot do operations on mismatched iterators")
 
+// assert if the iterator 'it' cannot be dereferenced
+#define _VECTOR_DEREFERENCEABLE_ITERATOR_ASSERT_(it) \
+			assert((it).pCurrent_ != (it).pVector_->elements_ + (it).pVector_->size_ \
+					&& "cannot dereference end-iterator")
+
+// assert if the iterator 'it' cannot be decremented
+#define _VECTOR_DECREMENTABLE_ITERATOR_ASSERT_(it) \
+			assert((it).pCurrent_ != (it).pVector_->elements_ \
+					&& "cannot decrement iterator pass begin")
+#else
+#define _VECTOR_UNINITIALIZED_ITERATOR_ASSERT_(it) ((void)0)
+#define _VECTOR_OUT_OF_BOUND_ITERATOR_ASSERT_(it) ((void)0)
+#define _VECTOR_MISMATCHED_ITERATOR_ASSERT_(itX, itY) ((void)0)
+#define _VECTOR_DEREFERENCEABLE_ITERATOR_ASSERT_(it) ((void)0)
+#define _VECTOR_DECREMENTABLE_ITERATOR_ASSERT_(it) ((void)0)
+#endif
+
 namespace experimental {
+	namespace details {
+		// check if 'InputIterator' is at least a forward iterator,
+		// i.e. the range can be walked twice to count its elements first
+		template<typename InputIterator, typename = void>
+		struct is_forward_iterator : std::false_type {};
+
+		template<typename InputIterator>
+		struct is_forward_iterator<InputIterator, std::void_t<typename std::iterator_traits<InputIterator>::iterator_category>>
+			: std::is_base_of<std::forward_iterator_tag, typename std::iterator_traits<InputIterator>::iterator_category> {};
+	}
+
 	/* 	Vector ADT class
 	 	provides a generic container with contiguous memory block
+		Note:
+		- The storage is uninitialized, only the elements in [0, size()) are constructed.
+		  value_type does not need to be default constructible unless Vector(sz) or resize() is used.
+		- Trivially relocatable elements (see is_trivially_relocatable) are moved with memcpy/memmove
+		  and the storage grows with realloc, which may extend it in place.
+		  Trivially copyable elements are also copied with memcpy.
+		- Storage comes from 'Allocator', any standard-compatible allocator (see pmr::Vector).
+		  Elements grow with realloc only if the allocator provides reallocate(), as experimental::Allocator does.
+		  The memcpy/memmove paths bypass the construct() and destroy() of the allocator.
+		- The capacity grows as 'GrowthPolicy' decides (see experimental_growth_policies.hpp),
+		  by 1.5 by default.
+		- A derived class may hand over inline storage (see SmallVector), which is used
+		  until the elements outgrow it and is never released to the allocator.
+		  The derived class moves its inline elements itself: a Vector only takes over heap storage.
 	*/
-	template<typename T>
+	template<typename T, typename Allocator = experimental::Allocator<T>, typename GrowthPolicy = DefaultGrowth>
 	class Vector {
 	private:
 		/*	ConstIterator class
@@ -54,15 +127,23 @@ namespace experimental {
 			and basic operations.
 			Note:
 			- Increment and decrement may cause overflow of arithmetic operations on numeric type.
+			- Checked iterators also hold the vector to assert on misuse,
+			  release iterators hold the pointer only (see _EXPERIMENTAL_VECTOR_CHECKED_ITERATORS_)
+			  and satisfy std::contiguous_iterator in C++20.
 		*/
 		class ConstIterator {
 		public:
 			using value_type = T;
 			using reference = value_type const &;
+			using pointer = value_type const *;
 			using difference_type = alias::pointer_difference_type;
+			using iterator_category = std::random_access_iterator_tag;
+#ifdef __cpp_lib_concepts
+			using iterator_concept = std::contiguous_iterator_tag;
+#endif
 
-			// Default constructor
-			ConstIterator() = delete;
+			// Default constructor: a singular iterator
+			ConstIterator() noexcept = default;
 
 			/* Operator overloadings */
 			// ======================================================================
@@ -71,6 +152,13 @@ namespace experimental {
 			reference operator*() const {
 				return retrieve();
 			}
+			pointer operator->() const {
+				return &retrieve();
+			}
+			// subscript operator
+			reference operator[](difference_type n) const {
+				return *(*this + n);
+			}
 			// prefix increment
 			ConstIterator& operator++() {
 				_VECTOR_UNINITIALIZED_ITERATOR_ASSERT_(*this);
@@ -99,15 +187,11 @@ namespace experimental {
 			}
 			// equal operator
 			bool operator==(ConstIterator const &rhs) const {
-				_VECTOR_UNINITIALIZED_ITERATOR_ASSERT_(*this);
-				_VECTOR_UNINITIALIZED_ITERATOR_ASSERT_(rhs);
 				_VECTOR_MISMATCHED_ITERATOR_ASSERT_(*this, rhs);
 				return pCurrent_ == rhs.pCurrent_;
 			}
 			// not equal operator
 			bool operator!=(ConstIterator const &rhs) const {
-				_VECTOR_UNINITIALIZED_ITERATOR_ASSERT_(*this);
-				_VECTOR_UNINITIALIZED_ITERATOR_ASSERT_(rhs);
 				_VECTOR_MISMATCHED_ITERATOR_ASSERT_(*this, rhs);
 				return pCurrent_ != rhs.pCurrent_;
 			}
@@ -140,27 +224,34 @@ namespace experimental {
 				return pCurrent_ >= rhs.pCurrent_;
 			}
 			// increment operator
-			ConstIterator operator+(alias::size_type n) {
+			ConstIterator operator+(difference_type n) const {
 				_VECTOR_UNINITIALIZED_ITERATOR_ASSERT_(*this);
-				return ConstIterator(pVector_, pCurrent_ + n);
+				ConstIterator it = *this;
+				it.pCurrent_ += n;
+				return it;
+			}
+			friend ConstIterator operator+(difference_type n, ConstIterator const &it) {
+				return it + n;
 			}
-			ConstIterator operator+=(alias::size_type n) {
+			ConstIterator& operator+=(difference_type n) {
 				_VECTOR_UNINITIALIZED_ITERATOR_ASSERT_(*this);
 				pCurrent_ += n;
 				return *this;
 			}
 			// decrement operator
-			ConstIterator operator-(alias::size_type n) {
+			ConstIterator operator-(difference_type n) const {
 				_VECTOR_UNINITIALIZED_ITERATOR_ASSERT_(*this);
-				return ConstIterator(pVector_, pCurrent_ - n);
+				ConstIterator it = *this;
+				it.pCurrent_ -= n;
+				return it;
 			}
-			ConstIterator operator-=(alias::size_type n) {
+			ConstIterator& operator-=(difference_type n) {
 				_VECTOR_UNINITIALIZED_ITERATOR_ASSERT_(*this);
 				pCurrent_ -= n;
 				return *this;
 			}
 			// arithmetic operator
-			difference_type operator-(ConstIterator const &rhs) {
+			difference_type operator-(ConstIterator const &rhs) const {
 				_VECTOR_UNINITIALIZED_ITERATOR_ASSERT_(*this);
 				_VECTOR_UNINITIALIZED_ITERATOR_ASSERT_(rhs);
 				_VECTOR_MISMATCHED_ITERATOR_ASSERT_(*this, rhs);
@@ -169,24 +260,30 @@ namespace experimental {
 
 
 		protected:
-			using pointer = value_type *;
-
-			Vector<value_type> const *pVector_;
-			pointer pCurrent_;
+#if _EXPERIMENTAL_VECTOR_CHECKED_ITERATORS_
+			Vector const *pVector_ = nullptr;
+#endif
+			value_type *pCurrent_ = nullptr;
 
-			ConstIterator(Vector<value_type> const *pVector, pointer p) noexcept
+			ConstIterator(Vector const *pVector, value_type *p) noexcept
+#if _EXPERIMENTAL_VECTOR_CHECKED_ITERATORS_
 				: pVector_{ pVector }, pCurrent_{ p }{}
+#else
+				: pCurrent_{ p } {
+				(void)pVector;
+			}
+#endif
 
 			value_type& retrieve() const {
 				_VECTOR_UNINITIALIZED_ITERATOR_ASSERT_(*this);
 				_VECTOR_OUT_OF_BOUND_ITERATOR_ASSERT_(*this);
-				assert(pCurrent_ != &pVector_->elements_[pVector_->size_] && "cannot dereference end-iterator");
+				_VECTOR_DEREFERENCEABLE_ITERATOR_ASSERT_(*this);
 				return *pCurrent_;
 			}
 			
 			/* Friend classes */
 			// ======================================================================
-			friend class Vector<value_type>;
+			friend class Vector;
 
 		};
 
@@ -199,35 +296,37 @@ namespace experimental {
 		class Iterator : public ConstIterator {
 		public:
 			using value_type = typename ConstIterator::value_type;
-			using reference = typename value_type &;
-			using const_reference = typename ConstIterator::reference;
-			using pointer = typename ConstIterator::pointer;
+			using reference = value_type &;
+			using pointer = value_type *;
+			using difference_type = typename ConstIterator::difference_type;
 
-			Iterator() = delete;
+			// Default constructor: a singular iterator
+			Iterator() noexcept = default;
 
 			/* Operator overloadings */
 			// ======================================================================
 
 			// dereference
-			reference operator*() {
+			reference operator*() const {
 				return ConstIterator::retrieve();
 			}
-			const_reference operator*() const {
-				return ConstIterator::operator*();
+			pointer operator->() const {
+				return &ConstIterator::retrieve();
+			}
+			// subscript operator
+			reference operator[](difference_type n) const {
+				return *(*this + n);
 			}
 			// prefix increment operator
 			Iterator& operator++() {
 				_VECTOR_UNINITIALIZED_ITERATOR_ASSERT_(*this);
 				_VECTOR_OUT_OF_BOUND_ITERATOR_ASSERT_(*this);
-				assert(pCurrent_ != &pVector_->elements_[pVector_->size_] && "cannot increment iterator pass end");
+				_VECTOR_DEREFERENCEABLE_ITERATOR_ASSERT_(*this);
 				++pCurrent_;
 				return *this;
 			}
 			// postfix increment operator 
 			Iterator operator++(int) {
-				_VECTOR_UNINITIALIZED_ITERATOR_ASSERT_(*this);
-				_VECTOR_OUT_OF_BOUND_ITERATOR_ASSERT_(*this);
-				assert(pCurrent_ != &pVector_->elements_[pVector_->size_] && "cannot increment iterator pass end");
 				Iterator old = *this;
 				++(*this);
 				return old;
@@ -236,54 +335,61 @@ namespace experimental {
 			Iterator& operator--() {
 				_VECTOR_UNINITIALIZED_ITERATOR_ASSERT_(*this);
 				_VECTOR_OUT_OF_BOUND_ITERATOR_ASSERT_(*this);
-				assert(pCurrent_ != pVector_->elements_ && "cannot decrement iterator pass begin");
+				_VECTOR_DECREMENTABLE_ITERATOR_ASSERT_(*this);
 				--pCurrent_;
 				return *this;
 			}
 			// postfix decrement operator
 			Iterator operator--(int) {
-				
-				_VECTOR_UNINITIALIZED_ITERATOR_ASSERT_(*this);
-				_VECTOR_OUT_OF_BOUND_ITERATOR_ASSERT_(*this);
-				assert(pCurrent_ != pVector_->elements_ && "cannot decrement iterator pass begin");
 				Iterator old = *this;
 				--(*this);
 				return old;
 			}
 			// increment operator
-			Iterator operator+(alias::size_type n) {
+			Iterator operator+(difference_type n) const {
 				_VECTOR_UNINITIALIZED_ITERATOR_ASSERT_(*this);
-				return Iterator(pVector_, pCurrent_ + n);
+				Iterator it = *this;
+				it.pCurrent_ += n;
+				return it;
+			}
+			friend Iterator operator+(difference_type n, Iterator const &it) {
+				return it + n;
 			}
-			Iterator operator+=(alias::size_type n) {
+			Iterator& operator+=(difference_type n) {
 				_VECTOR_UNINITIALIZED_ITERATOR_ASSERT_(*this);
 				pCurrent_ += n;
 				return *this;
 			}
 			// decrement operator
-			Iterator operator-(alias::size_type n) {
+			Iterator operator-(difference_type n) const {
 				_VECTOR_UNINITIALIZED_ITERATOR_ASSERT_(*this);
-				return Iterator(pVector_, pCurrent_ - n);
+				Iterator it = *this;
+				it.pCurrent_ -= n;
+				return it;
 			}
-			Iterator operator-=(alias::size_type n) {
+			Iterator& operator-=(difference_type n) {
 				_VECTOR_UNINITIALIZED_ITERATOR_ASSERT_(*this);
 				pCurrent_ -= n;
 				return *this;
 			}
+			// arithmetic operator, hidden by the decrement operator without this declaration
+			using ConstIterator::operator-;
 			
 			
 		protected:
 			// must declare names in base class here
 			// look-up mechanism will not work without declaration
+#if _EXPERIMENTAL_VECTOR_CHECKED_ITERATORS_
 			using ConstIterator::pVector_;
+#endif
 			using ConstIterator::pCurrent_;
 
-			Iterator(Vector<value_type> const *pVector, value_type *p) noexcept
+			Iterator(Vector const *pVector, value_type *p) noexcept
 				: ConstIterator(pVector, p) {}
 
 			/* Friend classes */
 			// ======================================================================
-			friend class Vector<value_type>;
+			friend class Vector;
 
 		};
 
@@ -292,6 +398,8 @@ namespace experimental {
 		using reference = value_type &;
 		using const_reference = value_type const &;
 		using size_type = alias::size_type;
+		using allocator_type = Allocator;
+		using growth_policy = GrowthPolicy;
 
 		using iterator = Iterator;
 		using const_iterator = ConstIterator;
@@ -299,63 +407,149 @@ namespace experimental {
 		/* The Big-Five */
 		// ===============================================================================
 		~Vector() {
-			delete[] elements_;
+			destroy(elements_, elements_ + size_);
+			deallocate(elements_, capacity_);
 		}
 
-		explicit Vector(size_type sz = 0)
-			: size_{ sz }, capacity_{ sz }, elements_{ new value_type[sz] }{}
+		Vector() noexcept(noexcept(allocator_type()))
+			: Vector(allocator_type()) {}
+
+		explicit Vector(allocator_type const &a) noexcept
+			: allocator_{ a }, size_{ 0 }, capacity_{ 0 }, elements_{ nullptr } {}
+
+		// create a vector of 'sz' value-initialized elements
+		explicit Vector(size_type sz, allocator_type const &a = allocator_type())
+			: allocator_{ a }, size_{ 0 }, capacity_{ sz }, elements_{ allocate(sz) } {
+			try {
+				for (; size_ < sz; ++size_) {
+					construct(elements_ + size_);
+				}
+			}
+			catch (...) {
+				// the destructor does not run for a vector whose constructor throws
+				release();
+				throw;
+			}
+		}
 
 		Vector(Vector const &v)
-			: size_{ v.size_ }, capacity_{ v.capacity_ }, elements_{ new value_type[v.size_] } {
-			for (size_type i = 0; i < size_; ++i) {
-				elements_[i] = v.elements_[i];
+			: allocator_{ alloc_traits::select_on_container_copy_construction(v.allocator_) },
+			size_{ 0 }, capacity_{ v.size_ }, elements_{ allocate(v.size_) } {
+			if constexpr (std::is_trivially_copyable<value_type>::value) {
+				copy_bytes(elements_, v.elements_, v.size_);
+				size_ = v.size_;
+			}
+			else {
+				try {
+					for (; size_ < v.size_; ++size_) {
+						construct(elements_ + size_, v.elements_[size_]);
+					}
+				}
+				catch (...) {
+					release();
+					throw;
+				}
 			}
 		}
 
 		Vector(Vector &&v) noexcept
-			: size_{ v.size_ }, capacity_{ v.capacity_ }, elements_{ v.elements_ } {
-			v.elements_ = nullptr;
-			v.size_ = 0;
-			v.capacity_ = 0;
+			: allocator_{ std::move(v.allocator_) }, size_{ 0 }, capacity_{ 0 }, elements_{ nullptr } {
+			take_storage(v);
 		}
 
 		Vector& operator=(Vector const &rhs) {
 			if (this != &rhs) {
-				delete[] elements_;
-				size_ = rhs.size_;
-				capacity_ = rhs.capacity_;
-				elements_ = new value_type[capacity_];
-				for (size_type i = 0; i < size_; ++i) {
-					elements_[i] = rhs.elements_[i];
+				if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+					if (allocator_ != rhs.allocator_) {
+						// the storage must be released by the allocator that got it
+						release();
+					}
+					allocator_ = rhs.allocator_;
+				}
+				if (rhs.size_ > capacity_) {
+					// not enough room: copy into new storage then release the old one
+					value_type *newArray = allocate(rhs.size_);
+					try {
+						copy_construct(rhs.elements_, rhs.elements_ + rhs.size_, newArray);
+					}
+					catch (...) {
+						deallocate(newArray, rhs.size_);
+						throw;
+					}
+					release();
+					elements_ = newArray;
+					size_ = capacity_ = rhs.size_;
+				}
+				else if constexpr (std::is_trivially_copyable<value_type>::value) {
+					// reuse the storage: the bytes are the values
+					copy_bytes(elements_, rhs.elements_, rhs.size_);
+					size_ = rhs.size_;
+				}
+				else {
+					// reuse the storage: assign over live elements, construct or destroy the rest
+					size_type i = 0;
+					for (size_type n = size_ < rhs.size_ ? size_ : rhs.size_; i < n; ++i) {
+						elements_[i] = rhs.elements_[i];
+					}
+					for (; i < rhs.size_; ++i) {
+						construct(elements_ + i, rhs.elements_[i]);
+					}
+					destroy(elements_ + rhs.size_, elements_ + size_);
+					size_ = rhs.size_;
 				}
 			}
 			return *this;
 		}
 
-		Vector& operator=(Vector &&rhs) noexcept {
-			using std::swap;
-			swap(size_, rhs.size_);
-			swap(capacity_, rhs.capacity_);
-			swap(elements_, rhs.elements_);
+		Vector& operator=(Vector &&rhs) noexcept(alloc_traits::propagate_on_container_move_assignment::value
+												 || alloc_traits::is_always_equal::value) {
+			if (this == &rhs) {
+				return *this;
+			}
+			clear();
+			if (!move_allocator(rhs)) {
+				// the storage of 'rhs' cannot be taken over: move the elements one by one
+				append(std::make_move_iterator(rhs.elements_), std::make_move_iterator(rhs.elements_ + rhs.size_));
+				rhs.clear();
+				return *this;
+			}
+			take_storage(rhs);
 			return *this;
 		}
 
 		/* Custom constructors */
 		// ===============================================================================
-		explicit Vector(std::initializer_list<value_type> const &l)
-			: size_{ 0 }, capacity_{ l.size() }, elements_{ new value_type[l.size()] } {
-			for (auto i = std::begin(l), end = std::end(l); i != end; ++i) {
-				push_back(*i);
+		explicit Vector(std::initializer_list<value_type> const &l, allocator_type const &a = allocator_type())
+			: allocator_{ a }, size_{ 0 }, capacity_{ l.size() }, elements_{ allocate(l.size()) } {
+			try {
+				for (auto i = std::begin(l), end = std::end(l); i != end; ++i, ++size_) {
+					construct(elements_ + size_, *i);
+				}
+			}
+			catch (...) {
+				release();
+				throw;
 			}
 		}
 
-		explicit Vector(std::initializer_list<value_type> &&l)
-			: size_{ 0 }, capacity_{ l.size() }, elements_{ new value_type[l.size()] } {
-			for (auto i = std::begin(l), end = std::end(l); i != end; ++i) {
-				push_back(std::move(*i));
+		explicit Vector(std::initializer_list<value_type> &&l, allocator_type const &a = allocator_type())
+			: allocator_{ a }, size_{ 0 }, capacity_{ l.size() }, elements_{ allocate(l.size()) } {
+			try {
+				for (auto i = std::begin(l), end = std::end(l); i != end; ++i, ++size_) {
+					construct(elements_ + size_, std::move(*i));
+				}
+			}
+			catch (...) {
+				release();
+				throw;
 			}
 		}
 
+		// get a copy of the allocator
+		allocator_type get_allocator() const noexcept {
+			return allocator_;
+		}
+
 		/* Element access */
 		// ===============================================================================
 
@@ -369,6 +563,14 @@ namespace experimental {
 			return elements_[idx];
 		}
 
+		// get the pointer to the underlying array
+		value_type* data() noexcept {
+			return elements_;
+		}
+		value_type const* data() const noexcept {
+			return elements_;
+		}
+
 		// get the first element of the vector
 		// do not check if the vector is empty
 		reference front() {
@@ -411,55 +613,266 @@ namespace experimental {
 		// if new capacity is less than current capacity, do nothing
 		void reserve(size_type newCapacity) {
 			if (newCapacity > capacity()) {
-				if (auto newArray = new value_type[newCapacity]) {
-					for (size_type i = 0, sz = size(); i < sz; ++i) {
-						newArray[i] = std::move(elements_[i]);
-					}
-					capacity_ = newCapacity;
-					delete[] elements_;
-					elements_ = newArray;
-				}
+				grow_storage(newCapacity);
 			}
 		}
 
 		// resize the vector
-		// increase the capacity to newsize x 1.5 if new size is greater than current size
+		// grow the capacity with the growth policy if new size is greater than current capacity,
+		// an empty vector grows to exactly new size
+		// new elements are value-initialized, removed elements are destroyed
 		void resize(size_type newSize) {
 			if (newSize > capacity()) {
-				reserve(static_cast<size_type>(newSize * 1.5));
+				reserve(grow_capacity(newSize));
 			}
+			for (; size_ < newSize; ++size_) {
+				construct(elements_ + size_);
+			}
+			destroy(elements_ + newSize, elements_ + size_);
 			size_ = newSize;
 		}
 
+		// reduce the capacity to the size, releasing the unused memory
+		// inline storage is kept
+		void shrink_to_fit() {
+			if (capacity_ == size_ || isInline_) {
+				return;
+			}
+			if (size_ == 0) {
+				deallocate(elements_, capacity_);
+				elements_ = nullptr;
+				capacity_ = 0;
+			}
+			else if constexpr (is_trivially_relocatable_v<value_type>) {
+				elements_ = reallocate(elements_, capacity_, size_);
+				capacity_ = size_;
+			}
+			else {
+				value_type *newArray = allocate(size_);
+				relocate(elements_, elements_ + size_, newArray);
+				deallocate(elements_, capacity_);
+				elements_ = newArray;
+				capacity_ = size_;
+			}
+		}
+
 		/* Modifying operations */
 		// ===============================================================================
 
 		// add new element into the end of the vector
 		// if the size == capacity, increase the capacity
 		void push_back(value_type const &e) { // lvalue version
-			if (size() == capacity()) {
-				reserve(static_cast<size_type>(capacity() * 1.5) + 1);
-			}
-			elements_[size_++] = e;
+			construct_back(e);
 		}
 		void push_back(value_type &&e) { // rvalue version
-			if (size() == capacity()) {
-				reserve(static_cast<size_type>(capacity() * 1.5) + 1);
+			construct_back(std::move(e));
+		}
+
+		// construct new element in place at the end of the vector
+		// return a reference to the new element
+		template<typename... Args>
+		reference emplace_back(Args&&... args) {
+			construct_back(std::forward<Args>(args)...);
+			return back();
+		}
+
+		// construct new element in place before 'pos'
+		// return the iterator pointing at the new element
+		template<typename... Args>
+		iterator emplace(const_iterator pos, Args&&... args) {
+			size_type idx = index_of(pos);
+			if (idx == size_) {
+				construct_back(std::forward<Args>(args)...);
+			}
+			else if (size_ == capacity_ && !is_trivially_relocatable_v<value_type>) {
+				reallocate_insert(idx, 1, [&](value_type *p) {
+					construct(p, std::forward<Args>(args)...);
+				});
+			}
+			else {
+				// 'args' may refer to an element of this vector, build the value before shifting
+				if constexpr (is_trivially_relocatable_v<value_type>) {
+					AsideElement e(std::forward<Args>(args)...);
+					if (size_ == capacity_) {
+						grow_storage(grow_capacity(size_ + 1));
+					}
+					open_gap(idx, 1, [&](value_type *p) {
+						e.relocate_to(p);
+					});
+				}
+				else {
+					value_type e(std::forward<Args>(args)...);
+					construct(elements_ + size_, std::move(e));
+					++size_;
+					std::rotate(elements_ + idx, elements_ + size_ - 1, elements_ + size_);
+				}
+			}
+			return { this, elements_ + idx };
+		}
+
+		// insert an element before 'pos'
+		// return the iterator pointing at the inserted element
+		iterator insert(const_iterator pos, value_type const &e) { // lvalue version
+			return emplace(pos, e);
+		}
+		iterator insert(const_iterator pos, value_type &&e) { // rvalue version
+			return emplace(pos, std::move(e));
+		}
+
+		// insert 'n' copies of 'e' before 'pos'
+		// reallocate at most once
+		// return the iterator pointing at the first inserted element
+		iterator insert(const_iterator pos, size_type n, value_type const &e) {
+			size_type idx = index_of(pos);
+			if (n == 0) {
+				return { this, elements_ + idx };
+			}
+			if (size_ + n > capacity_ && !is_trivially_relocatable_v<value_type>) {
+				reallocate_insert(idx, n, [&](value_type *p) {
+					fill_construct(p, n, e);
+				});
+			}
+			else {
+				// 'e' may refer to an element of this vector, copy it before shifting
+				value_type cpy(e);
+				if (size_ + n > capacity_) {
+					grow_storage(grow_capacity(size_ + n));
+				}
+				open_gap(idx, n, [&](value_type *p) {
+					fill_construct(p, n, cpy);
+				});
+			}
+			return { this, elements_ + idx };
+		}
+
+		// insert the elements in [first, last) before 'pos'
+		// [first, last) must not be a range of this vector
+		// reallocate at most once if the range can be counted beforehand (forward iterators)
+		// return the iterator pointing at the first inserted element
+		template<typename InputIterator, typename = std::enable_if_t<!std::is_integral<InputIterator>::value>>
+		iterator insert(const_iterator pos, InputIterator first, InputIterator last) {
+			size_type idx = index_of(pos);
+			if constexpr (details::is_forward_iterator<InputIterator>::value) {
+				size_type n = static_cast<size_type>(std::distance(first, last));
+				if (n == 0) {
+					return { this, elements_ + idx };
+				}
+				if (size_ + n > capacity_) {
+					reallocate_insert(idx, n, [&](value_type *p) {
+						copy_construct(first, last, p);
+					});
+				}
+				else {
+					open_gap(idx, n, [&](value_type *p) {
+						copy_construct(first, last, p);
+					});
+				}
+			}
+			else {
+				// single pass range: append then rotate into place
+				size_type oldSize = size_;
+				for (; first != last; ++first) {
+					construct_back(*first);
+				}
+				std::rotate(elements_ + idx, elements_ + oldSize, elements_ + size_);
+			}
+			return { this, elements_ + idx };
+		}
+
+		// insert the elements of the initializer list before 'pos'
+		iterator insert(const_iterator pos, std::initializer_list<value_type> l) {
+			return insert(pos, l.begin(), l.end());
+		}
+
+		// add the elements in [first, last) into the end of the vector
+		// reallocate at most once if the range can be counted beforehand (forward iterators)
+		template<typename InputIterator>
+		void append(InputIterator first, InputIterator last) {
+			insert(cend(), first, last);
+		}
+
+		// remove the element at 'pos'
+		// return the iterator pointing at the element following the removed one
+		iterator erase(const_iterator pos) {
+			return erase(pos, pos + 1);
+		}
+
+		// remove the elements in [first, last)
+		// the capacity is kept
+		// return the iterator pointing at the element following the removed ones
+		iterator erase(const_iterator first, const_iterator last) {
+			size_type idx = index_of(first);
+			size_type n = index_of(last) - idx;
+			if (n != 0) {
+				if constexpr (is_trivially_relocatable_v<value_type>) {
+					destroy(elements_ + idx, elements_ + idx + n);
+					move_bytes(elements_ + idx, elements_ + idx + n, size_ - idx - n);
+				}
+				else {
+					std::move(elements_ + idx + n, elements_ + size_, elements_ + idx);
+					destroy(elements_ + size_ - n, elements_ + size_);
+				}
+				size_ -= n;
 			}
-			elements_[size_++] = std::move(e);
+			return { this, elements_ + idx };
+		}
+
+		// replace the contents with 'n' copies of 'e'
+		void assign(size_type n, value_type const &e) {
+			// 'e' may refer to an element of this vector
+			value_type cpy(e);
+			clear();
+			insert(cend(), n, cpy);
+		}
+
+		// replace the contents with the elements in [first, last)
+		// [first, last) must not be a range of this vector
+		template<typename InputIterator, typename = std::enable_if_t<!std::is_integral<InputIterator>::value>>
+		void assign(InputIterator first, InputIterator last) {
+			clear();
+			insert(cend(), first, last);
+		}
+
+		// replace the contents with the elements of the initializer list
+		void assign(std::initializer_list<value_type> l) {
+			assign(l.begin(), l.end());
 		}
 
 		// remove the last element of the vector
 		// do not check if the vector is empty
 		void pop_back() {
 			--size_;
+			destroy(elements_ + size_, elements_ + size_ + 1);
 		}
 
 		// remove all the elements of the vector
+		// the capacity is kept
 		void clear() {
+			destroy(elements_, elements_ + size_);
 			size_ = 0;
 		}
 
+		// exchange the contents with 'v'
+		// the allocators are exchanged only if they propagate on swap
+		// elements in inline storage are exchanged one by one
+		void swap(Vector &v) {
+			using std::swap;
+			if constexpr (alloc_traits::propagate_on_container_swap::value) {
+				swap(allocator_, v.allocator_);
+			}
+			if (isInline_ || v.isInline_) {
+				swap_elements(v);
+				return;
+			}
+			swap(size_, v.size_);
+			swap(capacity_, v.capacity_);
+			swap(elements_, v.elements_);
+		}
+
+		friend void swap(Vector &lhs, Vector &rhs) {
+			lhs.swap(rhs);
+		}
+
 		/* Iterator operations */
 		// ===============================================================================
 
@@ -485,15 +898,380 @@ namespace experimental {
 			return { this, &elements_[size_] };
 		}
 
+	protected:
+		// create an empty vector that uses the inline storage of 'inlineCapacity' elements at 'inlineElements'
+		// the inline storage must outlive the vector
+		Vector(value_type *inlineElements, size_type inlineCapacity, allocator_type const &a) noexcept
+			: allocator_{ a }, isInline_{ true }, size_{ 0 }, capacity_{ inlineCapacity }, elements_{ inlineElements } {}
+
+		// take 'elements' got from the allocator as the storage of 'capacity' elements,
+		// of which the first 'sz' are constructed
+		// this vector must be empty and have no storage
+		void adopt_storage(value_type *elements, size_type sz, size_type capacity) noexcept {
+			elements_ = elements;
+			size_ = sz;
+			capacity_ = capacity;
+		}
+
+		// check if the elements are in the inline storage
+		bool is_inline() const noexcept {
+			return isInline_;
+		}
+
+		// relocate the elements to the inline storage of 'n' elements at 'p', which must hold them,
+		// and release the storage from the allocator
+		// this vector must not use its inline storage already
+		void use_inline_storage(value_type *p, size_type n) {
+			relocate(elements_, elements_ + size_, p);
+			deallocate(elements_, capacity_);
+			elements_ = p;
+			capacity_ = n;
+			isInline_ = true;
+		}
+
+		// relocate the elements in the inline storage of 'v' to the storage of this vector, which must hold them
+		// this vector must be empty
+		void relocate_elements(Vector &v) {
+			relocate(v.elements_, v.elements_ + v.size_, elements_);
+			size_ = v.size_;
+			v.size_ = 0;
+		}
+
+		// take over the storage of 'v', which must not be inline, and leave 'v' without storage
+		// this vector must be empty
+		void take_storage(Vector &v) noexcept {
+			assert(!v.isInline_ && "inline elements must be moved by the class owning the inline storage");
+			deallocate(elements_, capacity_);
+			elements_ = v.elements_;
+			size_ = v.size_;
+			capacity_ = v.capacity_;
+			isInline_ = false;
+			v.elements_ = nullptr;
+			v.size_ = v.capacity_ = 0;
+		}
+
+		// take the allocator of 'rhs' if it propagates on move assignment,
+		// after releasing the storage got from the old one if they differ
+		// return false if the storage of 'rhs' cannot be taken over: the allocators differ and do not propagate
+		// this vector must be empty
+		bool move_allocator(Vector &rhs) noexcept {
+			if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+				if (allocator_ != rhs.allocator_) {
+					// the storage must be released by the allocator that got it
+					release();
+				}
+				allocator_ = rhs.allocator_;
+				return true;
+			}
+			else {
+				return alloc_traits::is_always_equal::value || allocator_ == rhs.allocator_;
+			}
+		}
+
 	private:
+		using alloc_traits = std::allocator_traits<allocator_type>;
+
+		static_assert(std::is_same<typename alloc_traits::value_type, value_type>::value,
+					  "the allocator must allocate value_type");
+		static_assert(std::is_same<typename alloc_traits::pointer, value_type *>::value,
+					  "the allocator must return raw pointers");
+
+		allocator_type allocator_;
+		bool isInline_ = false; // the storage is owned by a derived class and never deallocated
 		size_type size_;
 		size_type capacity_;
-		value_type *elements_;
+		value_type *elements_; // only elements_[0, size_) are constructed
+
+		/*	AsideElement class
+			holds one trivially relocatable element built outside of the storage,
+			so that it may be constructed from an element of the vector before realloc
+		*/
+		class AsideElement {
+		public:
+			template<typename... Args>
+			explicit AsideElement(Args&&... args)
+				: pElement_{ ::new (static_cast<void *>(&buffer_)) value_type(std::forward<Args>(args)...) } {}
+
+			AsideElement(AsideElement const &) = delete;
+			AsideElement& operator=(AsideElement const &) = delete;
+
+			~AsideElement() {
+				if (pElement_) {
+					pElement_->~value_type();
+				}
+			}
+
+			// move the element to uninitialized storage at 'dest' with memcpy
+			void relocate_to(value_type *dest) noexcept {
+				copy_bytes(dest, pElement_, 1);
+				pElement_ = nullptr;
+			}
+
+		private:
+			std::aligned_storage_t<sizeof(value_type), alignof(value_type)> buffer_;
+			value_type *pElement_;
+		};
+
+		/* Storage operations */
+		// ===============================================================================
+
+		// get uninitialized storage for 'n' elements
+		value_type* allocate(size_type n) {
+			return n == 0 ? nullptr : alloc_traits::allocate(allocator_, n);
+		}
+
+		// resize the storage 'p' of 'oldN' elements to 'newN' elements, keeping the bytes of the elements
+		// the allocator extends the storage in place if it provides reallocate(),
+		// otherwise (or from the inline storage) the elements are copied to new storage
+		// only for trivially relocatable elements
+		value_type* reallocate(value_type *p, size_type oldN, size_type newN) {
+			if constexpr (details::has_reallocate<allocator_type>::value) {
+				if (p && !isInline_) {
+					return allocator_.reallocate(p, oldN, newN);
+				}
+			}
+			value_type *newP = allocate(newN);
+			copy_bytes(newP, p, size_ < newN ? size_ : newN);
+			deallocate(p, oldN);
+			return newP;
+		}
+
+		// release storage of 'n' elements got from allocate()
+		// the inline storage, which is 'elements_', is not released
+		void deallocate(value_type *p, size_type n) noexcept {
+			if (p && !(isInline_ && p == elements_)) {
+				alloc_traits::deallocate(allocator_, p, n);
+			}
+		}
+
+		// destroy the elements and release the storage, the vector is left without storage
+		void release() noexcept {
+			destroy(elements_, elements_ + size_);
+			deallocate(elements_, capacity_);
+			elements_ = nullptr;
+			size_ = capacity_ = 0;
+			isInline_ = false;
+		}
+
+		// exchange the elements with 'v' one by one
+		void swap_elements(Vector &v) {
+			Vector *shorter = size_ < v.size_ ? this : &v;
+			Vector *longer = size_ < v.size_ ? &v : this;
+			shorter->reserve(longer->size_);
+			using std::swap;
+			for (size_type i = 0; i < shorter->size_; ++i) {
+				swap(shorter->elements_[i], longer->elements_[i]);
+			}
+			for (size_type i = shorter->size_; i < longer->size_; ++i) {
+				shorter->construct(shorter->elements_ + i, std::move(longer->elements_[i]));
+			}
+			longer->destroy(longer->elements_ + shorter->size_, longer->elements_ + longer->size_);
+			swap(shorter->size_, longer->size_);
+		}
+
+		// copy the bytes of 'n' elements from 'src' to 'dest', the ranges must not overlap
+		static void copy_bytes(value_type *dest, value_type const *src, size_type n) noexcept {
+			if (n != 0) {
+				std::memcpy(static_cast<void *>(dest), static_cast<void const *>(src), n * sizeof(value_type));
+			}
+		}
+
+		// move the bytes of 'n' elements from 'src' to 'dest', the ranges may overlap
+		static void move_bytes(value_type *dest, value_type const *src, size_type n) noexcept {
+			if (n != 0) {
+				std::memmove(static_cast<void *>(dest), static_cast<void const *>(src), n * sizeof(value_type));
+			}
+		}
+
+		// construct an element in uninitialized storage
+		template<typename... Args>
+		void construct(value_type *p, Args&&... args) {
+			alloc_traits::construct(allocator_, p, std::forward<Args>(args)...);
+		}
+
+		// destroy the elements in [first, last)
+		void destroy(value_type *first, value_type *last) noexcept {
+			if constexpr (!std::is_trivially_destructible<value_type>::value) {
+				for (; first != last; ++first) {
+					alloc_traits::destroy(allocator_, first);
+				}
+			}
+		}
+
+		// move the elements in [first, last) to uninitialized storage at 'dest'
+		// and destroy the moved-from elements
+		void relocate(value_type *first, value_type *last, value_type *dest) {
+			if constexpr (is_trivially_relocatable_v<value_type>) {
+				copy_bytes(dest, first, last - first);
+			}
+			else {
+				for (value_type *p = first; p != last; ++p, ++dest) {
+					construct(dest, std::move(*p));
+				}
+				destroy(first, last);
+			}
+		}
+
+		// construct 'n' copies of 'e' in uninitialized storage at 'dest'
+		// if a copy throws, the copies already constructed are destroyed
+		void fill_construct(value_type *dest, size_type n, value_type const &e) {
+			value_type *p = dest;
+			try {
+				for (value_type *last = dest + n; p != last; ++p) {
+					construct(p, e);
+				}
+			}
+			catch (...) {
+				destroy(dest, p);
+				throw;
+			}
+		}
+
+		// construct copies of the elements in [first, last) in uninitialized storage at 'dest'
+		// a range of contiguous trivially copyable elements is copied with memcpy
+		// if a copy throws, the copies already constructed are destroyed
+		template<typename ForwardIterator>
+		void copy_construct(ForwardIterator first, ForwardIterator last, value_type *dest) {
+			if constexpr (std::is_trivially_copyable<value_type>::value
+						  && std::is_pointer<ForwardIterator>::value
+						  && std::is_same<std::remove_cv_t<std::remove_pointer_t<ForwardIterator>>, value_type>::value) {
+				if (first != last) {
+					copy_bytes(dest, first, last - first);
+				}
+			}
+			else {
+				value_type *p = dest;
+				try {
+					for (; first != last; ++first, ++p) {
+						construct(p, *first);
+					}
+				}
+				catch (...) {
+					destroy(dest, p);
+					throw;
+				}
+			}
+		}
+
+		// get the index of the element 'pos' points at
+		size_type index_of(const_iterator const &pos) const noexcept {
+			return static_cast<size_type>(pos.pCurrent_ - elements_);
+		}
+
+		// get the capacity after growing to hold at least 'minCapacity' elements
+		size_type grow_capacity(size_type minCapacity) const noexcept {
+			return growth_policy::grow(capacity(), minCapacity, sizeof(value_type));
+		}
+
+		// grow the storage to 'newCapacity' elements
+		// trivially relocatable elements are grown with realloc, the others are moved one by one
+		void grow_storage(size_type newCapacity) {
+			if constexpr (is_trivially_relocatable_v<value_type>) {
+				elements_ = reallocate(elements_, capacity_, newCapacity);
+			}
+			else {
+				value_type *newArray = allocate(newCapacity);
+				relocate(elements_, elements_ + size_, newArray);
+				deallocate(elements_, capacity_);
+				elements_ = newArray;
+			}
+			capacity_ = newCapacity;
+			isInline_ = false;
+		}
+
+		// move the elements into a single new storage leaving a gap of 'n' elements at 'idx',
+		// then fill the gap with 'constructGap'
+		// the gap is filled before the old elements are moved, so the new elements may refer to them
+		// for trivially relocatable elements the storage is reallocated first,
+		// so the new elements must not refer to this vector
+		template<typename GapConstructor>
+		void reallocate_insert(size_type idx, size_type n, GapConstructor constructGap) {
+			if constexpr (is_trivially_relocatable_v<value_type>) {
+				grow_storage(grow_capacity(size_ + n));
+				open_gap(idx, n, constructGap);
+				return;
+			}
+			size_type newCapacity = grow_capacity(size_ + n);
+			value_type *newArray = allocate(newCapacity);
+			try {
+				constructGap(newArray + idx);
+			}
+			catch (...) {
+				deallocate(newArray, newCapacity);
+				throw;
+			}
+			relocate(elements_, elements_ + idx, newArray);
+			relocate(elements_ + idx, elements_ + size_, newArray + idx + n);
+			deallocate(elements_, capacity_);
+			elements_ = newArray;
+			capacity_ = newCapacity;
+			isInline_ = false;
+			size_ += n;
+		}
+
+		// open a gap of 'n' elements at 'idx' in the current storage,
+		// then fill the gap with 'constructGap'
+		// the capacity must be enough for 'n' more elements
+		template<typename GapConstructor>
+		void open_gap(size_type idx, size_type n, GapConstructor constructGap) {
+			if constexpr (is_trivially_relocatable_v<value_type>) {
+				// shift the tail with one memmove, the gap is then raw storage
+				move_bytes(elements_ + idx + n, elements_ + idx, size_ - idx);
+				try {
+					constructGap(elements_ + idx);
+				}
+				catch (...) {
+					move_bytes(elements_ + idx, elements_ + idx + n, size_ - idx);
+					throw;
+				}
+				size_ += n;
+			}
+			else {
+				// build the new elements past the end, then rotate them into place
+				// 'constructGap' destroys what it constructed if it throws, so nothing is left past the end
+				constructGap(elements_ + size_);
+				size_ += n;
+				std::rotate(elements_ + idx, elements_ + size_ - n, elements_ + size_);
+			}
+		}
+
+		// construct an element at the end of the vector
+		// if the vector is full, the element is constructed in the new storage
+		// before the old elements are moved, so 'args' may refer to an element of this vector
+		template<typename... Args>
+		void construct_back(Args&&... args) {
+			if (size() == capacity()) {
+				if constexpr (is_trivially_relocatable_v<value_type>) {
+					// realloc may release the old storage, build the element aside first
+					AsideElement e(std::forward<Args>(args)...);
+					grow_storage(grow_capacity(size_ + 1));
+					e.relocate_to(elements_ + size_);
+					++size_;
+				}
+				else {
+					reallocate_insert(size_, 1, [&](value_type *p) {
+						construct(p, std::forward<Args>(args)...);
+					});
+				}
+			}
+			else {
+				construct(elements_ + size_, std::forward<Args>(args)...);
+				++size_;
+			}
+		}
 	};
+
+	namespace pmr {
+		// vector whose storage comes from a std::pmr::memory_resource
+		template<typename T>
+		using Vector = experimental::Vector<T, std::pmr::polymorphic_allocator<T>>;
+	}
 }
 
 
 #undef _VECTOR_UNINITIALIZED_ITERATOR_ASSERT_
 #undef _VECTOR_OUT_OF_BOUND_ITERATOR_ASSERT_
 #undef _VECTOR_MISMATCHED_ITERATOR_ASSERT_
+#undef _VECTOR_DEREFERENCEABLE_ITERATOR_ASSERT_
+#undef _VECTOR_DECREMENTABLE_ITERATOR_ASSERT_
 #endif // !_EXPERIMENTAL_VECTOR_HPP_
@@ -0,0 +1,601 @@
+/*
+ *	File name:	"experimental_allocators.hpp"
+ *	Date:		10/18/2026 7:03:18 PM
+ *	Author:		Vo, Dinh Tue Minh
+ *	Purpose:	Standard-compatible allocators used by the containers in the experimental namespace:
+ *				- Allocator: malloc-based, default of Vector, grows with realloc
+ *				- HugePageAllocator: backs large blocks with huge pages
+ *				- NumaAllocator: binds the blocks to a NUMA node
+ *				- PoolAllocator: node pool carved from slabs, for node-based containers
+ */
+
+#pragma once
+
+#ifndef _EXPERIMENTAL_ALLOCATORS_HPP_
+#define _EXPERIMENTAL_ALLOCATORS_HPP_
+
+#include "experimental_alias_declarations.hpp"
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace experimental {
+	namespace details {
+		// check if 'Alloc' provides reallocate(p, oldN, newN),
+		// which resizes a block keeping its bytes
+		template<typename Alloc, typename = void>
+		struct has_reallocate : std::false_type {};
+
+		template<typename Alloc>
+		struct has_reallocate<Alloc, std::void_t<decltype(std::declval<Alloc &>().reallocate(
+			std::declval<typename Alloc::value_type *>(), std::size_t{}, std::size_t{}))>>
+			: std::true_type {};
+
+		// round 'bytes' up to a multiple of 'granularity', a power of 2
+		inline std::size_t round_up(std::size_t bytes, std::size_t granularity) noexcept {
+			return (bytes + granularity - 1) & ~(granularity - 1);
+		}
+
+		// get the size of a regular page
+		inline std::size_t page_size() noexcept {
+#ifdef __linux__
+			static std::size_t const sz = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+			return sz;
+#else
+			return 4096;
+#endif
+		}
+	}
+
+	/*	Allocator class
+		allocates with malloc/free.
+		Provides reallocate() on top of the standard interface,
+		which containers use to grow trivially relocatable elements with realloc.
+		Note:
+		- The C library extends blocks in place when possible,
+		  and glibc remaps large blocks with mremap instead of copying them.
+	*/
+	template<typename T>
+	class Allocator {
+	public:
+		using value_type = T;
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+		using is_always_equal = std::true_type;
+		using propagate_on_container_move_assignment = std::true_type;
+
+		Allocator() noexcept = default;
+
+		template<typename U>
+		Allocator(Allocator<U> const &) noexcept {}
+
+		// get uninitialized storage for 'n' elements
+		value_type* allocate(size_type n) {
+			void *p = std::malloc(n * sizeof(value_type));
+			if (!p && n != 0) {
+				throw std::bad_alloc{};
+			}
+			return static_cast<value_type *>(p);
+		}
+
+		// release storage got from allocate()
+		void deallocate(value_type *p, size_type) noexcept {
+			std::free(p);
+		}
+
+		// resize storage got from allocate() from 'oldN' to 'newN' elements, keeping its bytes
+		value_type* reallocate(value_type *p, size_type, size_type newN) {
+			void *newP = std::realloc(static_cast<void *>(p), newN * sizeof(value_type));
+			if (!newP && newN != 0) {
+				throw std::bad_alloc{};
+			}
+			return static_cast<value_type *>(newP);
+		}
+	};
+
+	template<typename T, typename U>
+	bool operator==(Allocator<T> const &, Allocator<U> const &) noexcept {
+		return true;
+	}
+
+	template<typename T, typename U>
+	bool operator!=(Allocator<T> const &, Allocator<U> const &) noexcept {
+		return false;
+	}
+
+	/*	HugePageAllocator class
+		backs blocks of at least one huge page with huge pages to cut the TLB misses
+		on large buffers.
+		- Blocks are mapped with MAP_HUGETLB when the system has reserved huge pages
+		  (vm.nr_hugepages), otherwise they are mapped normally and marked
+		  with madvise(MADV_HUGEPAGE) for transparent huge pages.
+		- Smaller blocks come from malloc.
+		- reallocate() remaps the pages with mremap instead of copying them.
+		Note:
+		- Block sizes are rounded up to HUGE_PAGE_SIZE.
+		- On other systems than Linux, every block comes from malloc.
+	*/
+	template<typename T>
+	class HugePageAllocator {
+	public:
+		using value_type = T;
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+		using is_always_equal = std::true_type;
+		using propagate_on_container_move_assignment = std::true_type;
+
+		static constexpr size_type HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+		HugePageAllocator() noexcept = default;
+
+		template<typename U>
+		HugePageAllocator(HugePageAllocator<U> const &) noexcept {}
+
+		// get uninitialized storage for 'n' elements
+		value_type* allocate(size_type n) {
+			size_type bytes = n * sizeof(value_type);
+			void *p = is_mapped(bytes) ? map(bytes) : std::malloc(bytes);
+			if (!p && n != 0) {
+				throw std::bad_alloc{};
+			}
+			return static_cast<value_type *>(p);
+		}
+
+		// release storage got from allocate()
+		void deallocate(value_type *p, size_type n) noexcept {
+			size_type bytes = n * sizeof(value_type);
+			if (is_mapped(bytes)) {
+				unmap(p, bytes);
+			}
+			else {
+				std::free(p);
+			}
+		}
+
+		// resize storage got from allocate() from 'oldN' to 'newN' elements, keeping its bytes
+		value_type* reallocate(value_type *p, size_type oldN, size_type newN) {
+			size_type oldBytes = oldN * sizeof(value_type);
+			size_type newBytes = newN * sizeof(value_type);
+			if (!is_mapped(oldBytes) && !is_mapped(newBytes)) {
+				void *newP = std::realloc(static_cast<void *>(p), newBytes);
+				if (!newP && newN != 0) {
+					throw std::bad_alloc{};
+				}
+				return static_cast<value_type *>(newP);
+			}
+#ifdef __linux__
+			if (is_mapped(oldBytes) && is_mapped(newBytes)) {
+				size_type oldLength = details::round_up(oldBytes, HUGE_PAGE_SIZE);
+				size_type newLength = details::round_up(newBytes, HUGE_PAGE_SIZE);
+				if (oldLength == newLength) {
+					return p;
+				}
+				void *newP = mremap(static_cast<void *>(p), oldLength, newLength, MREMAP_MAYMOVE);
+				if (newP != MAP_FAILED) {
+					madvise(newP, newLength, MADV_HUGEPAGE);
+					return static_cast<value_type *>(newP);
+				}
+				// hugetlb mappings may refuse to move, copy them below
+			}
+#endif
+			value_type *newP = allocate(newN);
+			std::memcpy(static_cast<void *>(newP), static_cast<void const *>(p), oldBytes < newBytes ? oldBytes : newBytes);
+			deallocate(p, oldN);
+			return newP;
+		}
+
+	private:
+		// check if a block of 'bytes' is mapped instead of coming from malloc
+		static bool is_mapped(size_type bytes) noexcept {
+#ifdef __linux__
+			return bytes >= HUGE_PAGE_SIZE;
+#else
+			(void)bytes;
+			return false;
+#endif
+		}
+
+		static void* map(size_type bytes) noexcept {
+#ifdef __linux__
+			size_type length = details::round_up(bytes, HUGE_PAGE_SIZE);
+			void *p = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+			if (p == MAP_FAILED) {
+				// no reserved huge pages: ask for transparent huge pages
+				p = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+				if (p == MAP_FAILED) {
+					return nullptr;
+				}
+				madvise(p, length, MADV_HUGEPAGE);
+			}
+			return p;
+#else
+			return std::malloc(bytes);
+#endif
+		}
+
+		static void unmap(void *p, size_type bytes) noexcept {
+#ifdef __linux__
+			munmap(p, details::round_up(bytes, HUGE_PAGE_SIZE));
+#else
+			(void)bytes;
+			std::free(p);
+#endif
+		}
+	};
+
+	template<typename T, typename U>
+	bool operator==(HugePageAllocator<T> const &, HugePageAllocator<U> const &) noexcept {
+		return true;
+	}
+
+	template<typename T, typename U>
+	bool operator!=(HugePageAllocator<T> const &, HugePageAllocator<U> const &) noexcept {
+		return false;
+	}
+
+	/*	NumaAllocator class
+		maps blocks whose pages are bound to a NUMA node with mbind(MPOL_BIND),
+		so that a thread pinned to that node does not pay for cross-socket traffic.
+		Note:
+		- Block sizes are rounded up to the page size, the allocator suits large buffers.
+		- If the kernel refuses the binding (no NUMA support, node out of range),
+		  the block keeps the default policy, i.e. pages are placed on the node that first touches them.
+		- Allocators bound to different nodes are not equal,
+		  they are propagated on copy assignment, move assignment and swap.
+		- On other systems than Linux, every block comes from malloc.
+	*/
+	template<typename T>
+	class NumaAllocator {
+	public:
+		using value_type = T;
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+		using is_always_equal = std::false_type;
+		using propagate_on_container_copy_assignment = std::true_type;
+		using propagate_on_container_move_assignment = std::true_type;
+		using propagate_on_container_swap = std::true_type;
+
+		explicit NumaAllocator(int node = 0) noexcept
+			: node_{ node } {}
+
+		template<typename U>
+		NumaAllocator(NumaAllocator<U> const &a) noexcept
+			: node_{ a.node() } {}
+
+		// get the node the blocks are bound to
+		int node() const noexcept {
+			return node_;
+		}
+
+		// get the node of the CPU running the calling thread
+		// return 0 if unknown
+		static int current_node() noexcept {
+#if defined(__linux__) && defined(SYS_getcpu)
+			unsigned cpu = 0, node = 0;
+			if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) {
+				return static_cast<int>(node);
+			}
+#endif
+			return 0;
+		}
+
+		// get uninitialized storage for 'n' elements
+		value_type* allocate(size_type n) {
+			size_type bytes = n * sizeof(value_type);
+#ifdef __linux__
+			if (bytes == 0) {
+				return nullptr;
+			}
+			size_type length = details::round_up(bytes, details::page_size());
+			void *p = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+			if (p == MAP_FAILED) {
+				throw std::bad_alloc{};
+			}
+			bind(p, length);
+#else
+			void *p = std::malloc(bytes);
+			if (!p && n != 0) {
+				throw std::bad_alloc{};
+			}
+#endif
+			return static_cast<value_type *>(p);
+		}
+
+		// release storage got from allocate()
+		void deallocate(value_type *p, size_type n) noexcept {
+#ifdef __linux__
+			if (p) {
+				munmap(static_cast<void *>(p), details::round_up(n * sizeof(value_type), details::page_size()));
+			}
+#else
+			(void)n;
+			std::free(p);
+#endif
+		}
+
+	private:
+		int node_;
+
+#ifdef __linux__
+		// bind the pages of [p, p + length) to node_
+		void bind(void *p, size_type length) const noexcept {
+#ifdef SYS_mbind
+			constexpr int MPOL_BIND_MODE = 2; // MPOL_BIND of <linux/mempolicy.h>
+			constexpr int BITS_PER_MASK_WORD = 8 * sizeof(unsigned long);
+			constexpr int MAX_NODES = 1024;
+			if (node_ < 0 || node_ >= MAX_NODES) {
+				return;
+			}
+			unsigned long nodeMask[MAX_NODES / BITS_PER_MASK_WORD] = {};
+			nodeMask[node_ / BITS_PER_MASK_WORD] = 1UL << (node_ % BITS_PER_MASK_WORD);
+			syscall(SYS_mbind, p, length, MPOL_BIND_MODE, nodeMask, static_cast<unsigned long>(MAX_NODES), 0u);
+#else
+			(void)p;
+			(void)length;
+#endif
+		}
+#endif
+	};
+
+	template<typename T, typename U>
+	bool operator==(NumaAllocator<T> const &lhs, NumaAllocator<U> const &rhs) noexcept {
+		return lhs.node() == rhs.node();
+	}
+
+	template<typename T, typename U>
+	bool operator!=(NumaAllocator<T> const &lhs, NumaAllocator<U> const &rhs) noexcept {
+		return !(lhs == rhs);
+	}
+
+	namespace details {
+		/*	SlabPool class
+			hands out blocks of one size carved from slabs of 'slabBytes',
+			and keeps the freed blocks in a free list to hand them out again.
+			The block size is set by the first allocation.
+			Note:
+			- Not thread-safe.
+			- Slabs are only released by reset() and by the destructor.
+		*/
+		class SlabPool {
+		public:
+			explicit SlabPool(std::size_t slabBytes) noexcept
+				: slabBytes_{ slabBytes } {}
+
+			~SlabPool() {
+				release_slabs(nullptr);
+			}
+
+			SlabPool(SlabPool const &) = delete;
+			SlabPool& operator=(SlabPool const &) = delete;
+
+			// get the size of the slabs
+			std::size_t slab_bytes() const noexcept {
+				return slabBytes_;
+			}
+
+			// get the number of slabs
+			std::size_t slab_count() const noexcept {
+				return slabCount_;
+			}
+
+			// check if the pool hands out the blocks of objects of 'bytes' aligned to 'alignment',
+			// the first call sets the block size
+			bool serves(std::size_t bytes, std::size_t alignment) noexcept {
+				if (objectBytes_ == 0) {
+					std::size_t blockSize = round_up(bytes < sizeof(FreeBlock) ? sizeof(FreeBlock) : bytes, alignment);
+					if (alignment > alignof(std::max_align_t) || slabBytes_ < SLAB_HEADER_BYTES + blockSize) {
+						return false;
+					}
+					objectBytes_ = bytes;
+					objectAlignment_ = alignment;
+					blockSize_ = blockSize;
+				}
+				return is_block_size(bytes, alignment);
+			}
+
+			// check if objects of 'bytes' aligned to 'alignment' are the blocks of the pool
+			bool is_block_size(std::size_t bytes, std::size_t alignment) const noexcept {
+				return bytes == objectBytes_ && alignment == objectAlignment_;
+			}
+
+			// get a block, from the free list or else from the current slab
+			void* allocate() {
+				if (freeList_) {
+					FreeBlock *block = freeList_;
+					freeList_ = block->next_;
+					return block;
+				}
+				if (next_ == end_) {
+					add_slab();
+				}
+				void *block = next_;
+				next_ += blockSize_;
+				return block;
+			}
+
+			// put a block back to the free list
+			void deallocate(void *p) noexcept {
+				freeList_ = ::new (p) FreeBlock{ freeList_ };
+			}
+
+			// free every block at once: release all the slabs but the last one,
+			// which is reused from its beginning
+			// the blocks must not be used anymore
+			void reset() noexcept {
+				freeList_ = nullptr;
+				if (slabs_) {
+					release_slabs(slabs_);
+					slabs_->next_ = nullptr;
+					slabCount_ = 1;
+					next_ = reinterpret_cast<unsigned char *>(slabs_) + SLAB_HEADER_BYTES;
+				}
+			}
+
+		private:
+			struct FreeBlock {
+				FreeBlock *next_;
+			};
+
+			struct Slab {
+				Slab *next_;
+			};
+
+			// the blocks of a slab start after its header, aligned as any object
+			static constexpr std::size_t SLAB_HEADER_BYTES = (sizeof(Slab) + alignof(std::max_align_t) - 1)
+				/ alignof(std::max_align_t) * alignof(std::max_align_t);
+
+			std::size_t slabBytes_;
+			std::size_t objectBytes_ = 0;
+			std::size_t objectAlignment_ = 0;
+			std::size_t blockSize_ = 0;
+			std::size_t slabCount_ = 0;
+			Slab *slabs_ = nullptr;				// the last slab first
+			FreeBlock *freeList_ = nullptr;
+			unsigned char *next_ = nullptr;		// next block of the last slab
+			unsigned char *end_ = nullptr;		// past the last block of the last slab
+
+			void add_slab() {
+				Slab *slab = static_cast<Slab *>(::operator new(slabBytes_));
+				slab->next_ = slabs_;
+				slabs_ = slab;
+				++slabCount_;
+				next_ = reinterpret_cast<unsigned char *>(slab) + SLAB_HEADER_BYTES;
+				end_ = next_ + (slabBytes_ - SLAB_HEADER_BYTES) / blockSize_ * blockSize_;
+			}
+
+			// release the slabs after 'keep', all of them if null
+			void release_slabs(Slab *keep) noexcept {
+				Slab *slab = keep ? keep->next_ : slabs_;
+				while (slab) {
+					Slab *next = slab->next_;
+					::operator delete(static_cast<void *>(slab));
+					slab = next;
+				}
+				if (!keep) {
+					slabs_ = nullptr;
+					slabCount_ = 0;
+					next_ = end_ = nullptr;
+				}
+			}
+		};
+	}
+
+	/*	PoolAllocator class
+		allocates single objects from a pool of fixed-size blocks carved from large slabs,
+		made for the nodes of node-based containers (see List).
+		Allocating and deallocating a node is popping and pushing a free list,
+		and nodes allocated together are next to each other in memory.
+		- A default-constructed allocator has its own pool, copies of it share that pool:
+		  pass the same allocator to several containers to share a pool between them.
+		- A container copy gets a new pool (select_on_container_copy_construction).
+		- reset() frees every node at once, containers do it in clear() when the pool is not shared.
+		Note:
+		- Not thread-safe, even across containers sharing a pool.
+		- Arrays, and objects of another size than the first one allocated, come from operator new.
+		- The pool keeps its slabs until reset() or until the last allocator using it is destroyed.
+	*/
+	template<typename T>
+	class PoolAllocator {
+	public:
+		using value_type = T;
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+		using is_always_equal = std::false_type;
+		using propagate_on_container_copy_assignment = std::true_type;
+		using propagate_on_container_move_assignment = std::true_type;
+		using propagate_on_container_swap = std::true_type;
+
+		static constexpr size_type DEFAULT_SLAB_BYTES = 64 * 1024;
+
+		// create an allocator with a new pool of slabs of 'slabBytes'
+		explicit PoolAllocator(size_type slabBytes = DEFAULT_SLAB_BYTES)
+			: pool_{ std::make_shared<details::SlabPool>(slabBytes) } {}
+
+		// copies share the pool, even moved ones so that the source stays usable
+		PoolAllocator(PoolAllocator const &) noexcept = default;
+		PoolAllocator& operator=(PoolAllocator const &) noexcept = default;
+
+		template<typename U>
+		PoolAllocator(PoolAllocator<U> const &a) noexcept
+			: pool_{ a.pool_ } {}
+
+		// a container copy gets its own pool
+		PoolAllocator select_on_container_copy_construction() const {
+			return PoolAllocator(pool_->slab_bytes());
+		}
+
+		// get uninitialized storage for 'n' objects
+		value_type* allocate(size_type n) {
+			if (n == 1 && pool_->serves(sizeof(value_type), alignof(value_type))) {
+				return static_cast<value_type *>(pool_->allocate());
+			}
+			return std::allocator<value_type>().allocate(n);
+		}
+
+		// release storage got from allocate()
+		void deallocate(value_type *p, size_type n) noexcept {
+			if (n == 1 && pool_->is_block_size(sizeof(value_type), alignof(value_type))) {
+				pool_->deallocate(p);
+			}
+			else {
+				std::allocator<value_type>().deallocate(p, n);
+			}
+		}
+
+		// check if another allocator uses the pool
+		bool is_shared() const noexcept {
+			return pool_.use_count() > 1;
+		}
+
+		// free every block of the pool at once, the blocks must not be used anymore
+		void reset() noexcept {
+			pool_->reset();
+		}
+
+		// get the number of slabs of the pool
+		size_type slab_count() const noexcept {
+			return pool_->slab_count();
+		}
+
+		template<typename U, typename V>
+		friend bool operator==(PoolAllocator<U> const &lhs, PoolAllocator<V> const &rhs) noexcept;
+
+	private:
+		std::shared_ptr<details::SlabPool> pool_;
+
+		template<typename U>
+		friend class PoolAllocator;
+	};
+
+	template<typename T, typename U>
+	bool operator==(PoolAllocator<T> const &lhs, PoolAllocator<U> const &rhs) noexcept {
+		return lhs.pool_ == rhs.pool_;
+	}
+
+	template<typename T, typename U>
+	bool operator!=(PoolAllocator<T> const &lhs, PoolAllocator<U> const &rhs) noexcept {
+		return !(lhs == rhs);
+	}
+
+	namespace details {
+		// check if an allocator can free all its blocks at once, as PoolAllocator
+		template<typename Alloc, typename = void>
+		struct has_pool_reset : std::false_type {};
+
+		template<typename Alloc>
+		struct has_pool_reset<Alloc, std::void_t<decltype(std::declval<Alloc const &>().is_shared()),
+			decltype(std::declval<Alloc &>().reset())>> : std::true_type {};
+	}
+}
+
+#endif // !_EXPERIMENTAL_ALLOCATORS_HPP_
@@ -0,0 +1,242 @@
+/*
+ *	File name:	"experimental_concurrency.hpp"
+ *	Date:		10/19/2026 8:02:26 AM
+ *	Author:		Vo, Dinh Tue Minh
+ *	Purpose:	Building blocks of the concurrent containers:
+ *				- CACHE_LINE_SIZE: alignment that keeps hot atomics on their own cache line
+ *				- Backoff: spins with growing pauses then yields, for retry loops under contention
+ *				- EpochGuard, retire(): epoch-based reclamation of the nodes unlinked from lock-free structures
+ */
+
+#pragma once
+
+#ifndef _EXPERIMENTAL_CONCURRENCY_HPP_
+#define _EXPERIMENTAL_CONCURRENCY_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace experimental {
+	// size of a cache line, the alignment of atomics written by different threads
+	constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+	namespace details {
+		// hint the CPU that the thread spins
+		inline void cpu_relax() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+			__builtin_ia32_pause();
+#elif defined(__aarch64__)
+			asm volatile("yield");
+#endif
+		}
+	}
+
+	/*	Backoff class
+		waits between the retries of a failed compare-and-swap or of a full or empty queue:
+		spins 1, 2, 4, ... pauses, then yields the CPU once the spins get long,
+		so that threads outnumbering the cores let the others progress
+	*/
+	class Backoff {
+	public:
+		void pause() noexcept {
+			if (step_ <= SPIN_LIMIT) {
+				for (unsigned i = 0; i < (1u << step_); ++i) {
+					details::cpu_relax();
+				}
+				++step_;
+			}
+			else {
+				std::this_thread::yield();
+			}
+		}
+
+		void reset() noexcept {
+			step_ = 0;
+		}
+
+	private:
+		static constexpr unsigned SPIN_LIMIT = 6;
+
+		unsigned step_ = 0;
+	};
+
+	namespace details {
+		/*	EpochDomain class
+			epoch-based reclamation: a node unlinked from a lock-free structure is retired
+			with the global epoch, and freed once the epoch has advanced twice,
+			as every thread that could still read it was pinned in an earlier epoch.
+			The epoch advances when every pinned thread has seen the current one.
+			Note:
+			- There is one domain for the process, each thread gets a record on first use.
+			- Records are reused by later threads, with the nodes they retired.
+		*/
+		class EpochDomain {
+		public:
+			// the domain of the process
+			static EpochDomain& instance() {
+				static EpochDomain domain;
+				return domain;
+			}
+
+			~EpochDomain() {
+				Record *r = records_.load(std::memory_order_acquire);
+				while (r) {
+					Record *next = r->next_;
+					for (auto &bag : r->bags_) {
+						free_all(bag);
+					}
+					delete r;
+					r = next;
+				}
+			}
+
+			EpochDomain(EpochDomain const &) = delete;
+			EpochDomain& operator=(EpochDomain const &) = delete;
+
+			// pin the calling thread in the current epoch, pins nest
+			void pin() {
+				Record *r = local_record();
+				if (r->depth_++ > 0) {
+					return;
+				}
+				std::uint64_t epoch = epoch_.load(std::memory_order_seq_cst);
+				// sequentially consistent: the pin is visible before the structure is read
+				r->state_.store((epoch << 1) | PINNED, std::memory_order_seq_cst);
+				if (epoch != r->lastEpoch_) {
+					// bag (epoch + 1) % 3 holds the nodes retired two epochs ago or earlier
+					r->lastEpoch_ = epoch;
+					free_all(r->bags_[(epoch + 1) % BAGS]);
+				}
+			}
+
+			void unpin() noexcept {
+				Record *r = local_record();
+				if (--r->depth_ == 0) {
+					r->state_.store(0, std::memory_order_release);
+				}
+			}
+
+			// free 'p' with 'deleter' once no pinned thread can read it
+			// 'p' must be unlinked, and the calling thread pinned
+			void retire(void *p, void (*deleter)(void *)) {
+				Record *r = local_record();
+				std::uint64_t epoch = epoch_.load(std::memory_order_seq_cst);
+				r->bags_[epoch % BAGS].push_back(Retired{ p, deleter });
+				if (++r->retiredSinceAdvance_ >= ADVANCE_PERIOD) {
+					r->retiredSinceAdvance_ = 0;
+					try_advance(epoch);
+				}
+			}
+
+		private:
+			static constexpr std::uint64_t PINNED = 1;
+			static constexpr std::size_t BAGS = 3;
+			static constexpr unsigned ADVANCE_PERIOD = 64;
+
+			struct Retired {
+				void *p_;
+				void (*deleter_)(void *);
+			};
+
+			struct alignas(CACHE_LINE_SIZE) Record {
+				std::atomic<std::uint64_t> state_{ 0 };		// epoch << 1 | PINNED while pinned
+				std::atomic<bool> inUse_{ true };
+				Record *next_ = nullptr;
+				// owned by the thread using the record
+				unsigned depth_ = 0;
+				unsigned retiredSinceAdvance_ = 0;
+				std::uint64_t lastEpoch_ = 0;
+				std::vector<Retired> bags_[BAGS];
+			};
+
+			// give the record back when the thread exits
+			struct RecordHandle {
+				Record *record_ = nullptr;
+
+				~RecordHandle() {
+					if (record_) {
+						record_->inUse_.store(false, std::memory_order_release);
+					}
+				}
+			};
+
+			alignas(CACHE_LINE_SIZE) std::atomic<std::uint64_t> epoch_{ 0 };
+			alignas(CACHE_LINE_SIZE) std::atomic<Record *> records_{ nullptr };
+
+			EpochDomain() = default;
+
+			Record* local_record() {
+				static thread_local RecordHandle handle;
+				if (!handle.record_) {
+					handle.record_ = acquire_record();
+				}
+				return handle.record_;
+			}
+
+			// reuse a free record, or push a new one to the list of records
+			Record* acquire_record() {
+				for (Record *r = records_.load(std::memory_order_acquire); r; r = r->next_) {
+					bool inUse = false;
+					if (!r->inUse_.load(std::memory_order_relaxed)
+						&& r->inUse_.compare_exchange_strong(inUse, true, std::memory_order_acquire)) {
+						return r;
+					}
+				}
+				Record *r = new Record;
+				Record *head = records_.load(std::memory_order_relaxed);
+				do {
+					r->next_ = head;
+				} while (!records_.compare_exchange_weak(head, r, std::memory_order_release, std::memory_order_relaxed));
+				return r;
+			}
+
+			// advance the epoch if every pinned thread is in 'epoch'
+			void try_advance(std::uint64_t epoch) noexcept {
+				for (Record *r = records_.load(std::memory_order_acquire); r; r = r->next_) {
+					std::uint64_t state = r->state_.load(std::memory_order_seq_cst);
+					if ((state & PINNED) && (state >> 1) != epoch) {
+						return;
+					}
+				}
+				epoch_.compare_exchange_strong(epoch, epoch + 1, std::memory_order_seq_cst);
+			}
+
+			static void free_all(std::vector<Retired> &bag) noexcept {
+				for (auto const &retired : bag) {
+					retired.deleter_(retired.p_);
+				}
+				bag.clear();
+			}
+		};
+	}
+
+	/*	EpochGuard class
+		pins the thread for its lifetime: the nodes retired meanwhile are not freed,
+		so the nodes read from a lock-free structure stay valid while the guard lives
+	*/
+	class EpochGuard {
+	public:
+		EpochGuard() {
+			details::EpochDomain::instance().pin();
+		}
+
+		~EpochGuard() {
+			details::EpochDomain::instance().unpin();
+		}
+
+		EpochGuard(EpochGuard const &) = delete;
+		EpochGuard& operator=(EpochGuard const &) = delete;
+	};
+
+	// delete 'p' once no thread pinned by an EpochGuard can read it
+	// 'p' must be unlinked from the structure, and the calling thread pinned
+	template<typename T>
+	void retire(T *p) {
+		details::EpochDomain::instance().retire(p, [](void *q) { delete static_cast<T *>(q); });
+	}
+}
+
+#endif // !_EXPERIMENTAL_CONCURRENCY_HPP_
@@ -0,0 +1,77 @@
+/*
+ *	File name:	"experimental_growth_policies.hpp"
+ *	Date:		10/18/2026 9:48:21 PM
+ *	Author:		Vo, Dinh Tue Minh
+ *	Purpose:	Compile-time growth policies of the contiguous containers
+ *				A policy provides
+ *					static size_type grow(size_type capacity, size_type minCapacity, size_type elementSize)
+ *				which returns the new capacity, not less than minCapacity,
+ *				when 'capacity' elements of 'elementSize' bytes are not enough
+ */
+
+#pragma once
+
+#ifndef _EXPERIMENTAL_GROWTH_POLICIES_HPP_
+#define _EXPERIMENTAL_GROWTH_POLICIES_HPP_
+
+#include "experimental_alias_declarations.hpp"
+#include "experimental_allocators.hpp"
+
+namespace experimental {
+	/*	GeometricGrowth policy
+		multiplies the capacity by Numerator / Denominator, plus 1 to leave an empty vector.
+		Appending n elements one by one costs O(n) amortized copies.
+	*/
+	template<alias::size_type Numerator, alias::size_type Denominator>
+	struct GeometricGrowth {
+		static_assert(Numerator > Denominator && Denominator > 0, "the growth factor must be greater than 1");
+
+		using size_type = alias::size_type;
+
+		static size_type grow(size_type capacity, size_type minCapacity, size_type) noexcept {
+			size_type newCapacity = capacity / Denominator * Numerator + capacity % Denominator * Numerator / Denominator + 1;
+			return newCapacity < minCapacity ? minCapacity : newCapacity;
+		}
+	};
+
+	// grow by 1.5, the default
+	using DefaultGrowth = GeometricGrowth<3, 2>;
+
+	// double the capacity
+	using DoublingGrowth = GeometricGrowth<2, 1>;
+
+	/*	ExactGrowth policy
+		grows to the requested capacity only, so no memory is wasted.
+		Note:
+		- Appending elements one by one reallocates at every element,
+		  reserve() the final size first.
+	*/
+	struct ExactGrowth {
+		using size_type = alias::size_type;
+
+		static size_type grow(size_type, size_type minCapacity, size_type) noexcept {
+			return minCapacity;
+		}
+	};
+
+	/*	PageRoundedGrowth policy
+		grows with 'Growth', then rounds blocks of at least LargeBytes up to whole pages,
+		the granularity in which large blocks are mapped anyway.
+		The tail of the last page holds elements instead of being wasted.
+	*/
+	template<typename Growth = DefaultGrowth, alias::size_type LargeBytes = 128 * 1024>
+	struct PageRoundedGrowth {
+		using size_type = alias::size_type;
+
+		static size_type grow(size_type capacity, size_type minCapacity, size_type elementSize) noexcept {
+			size_type newCapacity = Growth::grow(capacity, minCapacity, elementSize);
+			size_type bytes = newCapacity * elementSize;
+			if (bytes < LargeBytes) {
+				return newCapacity;
+			}
+			return details::round_up(bytes, details::page_size()) / elementSize;
+		}
+	};
+}
+
+#endif // !_EXPERIMENTAL_GROWTH_POLICIES_HPP_
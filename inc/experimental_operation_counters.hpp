@@ -0,0 +1,169 @@
+/*
+ *	File name:	"experimental_operation_counters.hpp"
+ *	Date:		10/18/2026 1:41:09 PM
+ *	Author:		Vo, Dinh Tue Minh
+ *	Purpose:	Opt-in instrumentation that counts the comparisons, copies,
+ *				moves and swaps performed by an algorithm
+ */
+
+#pragma once
+
+#ifndef _EXPERIMENTAL_OPERATION_COUNTERS_HPP_
+#define _EXPERIMENTAL_OPERATION_COUNTERS_HPP_
+
+#include "experimental_alias_declarations.hpp"
+
+#include <utility>
+
+namespace experimental {
+
+	/*	Tallies of the operations
+		Note:
+		- The counters are shared by all Counted<T> and CountingComparator
+		  and are not thread-safe.
+	*/
+	struct OperationCounts {
+		alias::size_type comparisons = 0;
+		alias::size_type copies = 0;
+		alias::size_type moves = 0;
+		alias::size_type swaps = 0;
+
+		// set all counters to 0
+		void reset() noexcept {
+			*this = OperationCounts{};
+		}
+
+		// add the counters of 'rhs'
+		OperationCounts& operator+=(OperationCounts const &rhs) noexcept {
+			comparisons += rhs.comparisons;
+			copies += rhs.copies;
+			moves += rhs.moves;
+			swaps += rhs.swaps;
+			return *this;
+		}
+	};
+
+	// get the shared counters
+	inline OperationCounts& operation_counts() noexcept {
+		static OperationCounts counts;
+		return counts;
+	}
+
+	/*	Counted class
+		wraps a value and counts the operations done on it.
+		Algorithms sorting a Counted<T> array need no change:
+		- operator< and the other relational operators count comparisons
+		- copy construction/assignment count copies
+		- move construction/assignment count moves
+		- swap, found by argument-dependent lookup, counts swaps
+	*/
+	template<typename T>
+	class Counted {
+	public:
+		using value_type = T;
+
+		/* The Big-Five */
+		// ======================================================================
+		~Counted() = default;
+
+		Counted()
+			: value_{} {}
+
+		Counted(Counted const &c)
+			: value_{ c.value_ } {
+			++operation_counts().copies;
+		}
+
+		Counted(Counted &&c) noexcept
+			: value_{ std::move(c.value_) } {
+			++operation_counts().moves;
+		}
+
+		Counted& operator=(Counted const &rhs) {
+			value_ = rhs.value_;
+			++operation_counts().copies;
+			return *this;
+		}
+
+		Counted& operator=(Counted &&rhs) noexcept {
+			value_ = std::move(rhs.value_);
+			++operation_counts().moves;
+			return *this;
+		}
+
+		/* Custom constructors */
+		// ======================================================================
+		explicit Counted(value_type const &value)
+			: value_{ value } {}
+
+		explicit Counted(value_type &&value)
+			: value_{ std::move(value) } {}
+
+		/* Element access */
+		// ======================================================================
+
+		// get the wrapped value without counting
+		value_type const& value() const noexcept {
+			return value_;
+		}
+
+		/* Operator overloadings */
+		// ======================================================================
+		friend bool operator<(Counted const &lhs, Counted const &rhs) {
+			++operation_counts().comparisons;
+			return lhs.value_ < rhs.value_;
+		}
+		friend bool operator>(Counted const &lhs, Counted const &rhs) {
+			++operation_counts().comparisons;
+			return rhs.value_ < lhs.value_;
+		}
+		friend bool operator<=(Counted const &lhs, Counted const &rhs) {
+			++operation_counts().comparisons;
+			return !(rhs.value_ < lhs.value_);
+		}
+		friend bool operator>=(Counted const &lhs, Counted const &rhs) {
+			++operation_counts().comparisons;
+			return !(lhs.value_ < rhs.value_);
+		}
+		friend bool operator==(Counted const &lhs, Counted const &rhs) {
+			++operation_counts().comparisons;
+			return lhs.value_ == rhs.value_;
+		}
+		friend bool operator!=(Counted const &lhs, Counted const &rhs) {
+			++operation_counts().comparisons;
+			return !(lhs.value_ == rhs.value_);
+		}
+
+		// swap two values, counted as one swap and no move
+		friend void swap(Counted &lhs, Counted &rhs) noexcept {
+			using std::swap;
+			swap(lhs.value_, rhs.value_);
+			++operation_counts().swaps;
+		}
+
+	private:
+		value_type value_;
+	};
+
+	/*	CountingComparator class
+		wraps a comparator and counts its calls.
+		Used to count the comparisons on plain types, e.g. int.
+	*/
+	template<typename Comparator>
+	class CountingComparator {
+	public:
+		explicit CountingComparator(Comparator cmp = Comparator())
+			: cmp_{ cmp } {}
+
+		template<typename T, typename U>
+		bool operator()(T const &lhs, U const &rhs) const {
+			++operation_counts().comparisons;
+			return cmp_(lhs, rhs);
+		}
+
+	private:
+		Comparator cmp_;
+	};
+}
+
+#endif // !_EXPERIMENTAL_OPERATION_COUNTERS_HPP_
@@ -0,0 +1,481 @@
+/*
+ *	File name:	"experimental_simd_algorithms.hpp"
+ *	Date:		10/19/2026 1:21:40 AM
+ *	Author:		Vo, Dinh Tue Minh
+ *	Purpose:	Search and reduction algorithms vectorized with SSE4/AVX2:
+ *				find, count, minmax_element, accumulate, equal,
+ *				and a branchless lower_bound
+ */
+
+#pragma once
+
+#ifndef _EXPERIMENTAL_SIMD_ALGORITHMS_HPP_
+#define _EXPERIMENTAL_SIMD_ALGORITHMS_HPP_
+
+#include "experimental_alias_declarations.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+// the vectorized kernels need the GCC/Clang target pragmas and x86 intrinsics
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define _EXPERIMENTAL_SIMD_X86_ 1
+#include <immintrin.h>
+#else
+#define _EXPERIMENTAL_SIMD_X86_ 0
+#endif
+
+namespace experimental {
+	namespace simd {
+		// instruction sets the algorithms can run with
+		enum class SimdLevel {
+			SCALAR,
+			SSE4,		// SSE4.2, 128-bit registers
+			AVX2		// 256-bit registers
+		};
+
+		// get the best instruction set the CPU supports
+		inline SimdLevel supported_simd_level() noexcept {
+#if _EXPERIMENTAL_SIMD_X86_
+			static SimdLevel const level = []() {
+				__builtin_cpu_init();
+				return __builtin_cpu_supports("avx2") ? SimdLevel::AVX2
+					: __builtin_cpu_supports("sse4.2") ? SimdLevel::SSE4
+					: SimdLevel::SCALAR;
+			}();
+			return level;
+#else
+			return SimdLevel::SCALAR;
+#endif
+		}
+
+		namespace details {
+			inline std::atomic<SimdLevel>& active_level() noexcept {
+				static std::atomic<SimdLevel> level{ supported_simd_level() };
+				return level;
+			}
+		}
+
+		// get the instruction set the algorithms run with, the supported one by default
+		inline SimdLevel simd_level() noexcept {
+			return details::active_level().load(std::memory_order_relaxed);
+		}
+
+		// run the algorithms with 'level', lowered to the supported one
+		// used to compare the instruction sets, e.g. in tests and benchmarks
+		inline void set_simd_level(SimdLevel level) noexcept {
+			SimdLevel supported = supported_simd_level();
+			details::active_level().store(level < supported ? level : supported, std::memory_order_relaxed);
+		}
+
+		namespace details {
+			// check if the kernels handle value type 'T'
+			template<typename T>
+			constexpr bool has_kernels_v = std::is_same<T, std::int32_t>::value || std::is_same<T, float>::value;
+
+			// check if 'Iterator' is a pointer to a value type the kernels handle
+			template<typename Iterator>
+			constexpr bool is_vectorizable_v = std::is_pointer<Iterator>::value
+				&& has_kernels_v<std::remove_cv_t<std::remove_pointer_t<Iterator>>>;
+
+#if _EXPERIMENTAL_SIMD_X86_
+#pragma GCC push_options
+#pragma GCC target("sse4.2")
+			namespace sse4 {
+				template<typename T>
+				struct Lanes;
+
+				template<>
+				struct Lanes<std::int32_t> {
+					using vector_type = __m128i;
+					static constexpr alias::size_type N = 4;
+
+					static vector_type load(std::int32_t const *p) { return _mm_loadu_si128(reinterpret_cast<__m128i const *>(p)); }
+					static void store(std::int32_t *p, vector_type a) { _mm_storeu_si128(reinterpret_cast<__m128i *>(p), a); }
+					static vector_type set1(std::int32_t value) { return _mm_set1_epi32(value); }
+					static unsigned eq_mask(vector_type a, vector_type b) {
+						return static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b))));
+					}
+					static vector_type add(vector_type a, vector_type b) { return _mm_add_epi32(a, b); }
+					static vector_type min(vector_type a, vector_type b) { return _mm_min_epi32(a, b); }
+					static vector_type max(vector_type a, vector_type b) { return _mm_max_epi32(a, b); }
+				};
+
+				template<>
+				struct Lanes<float> {
+					using vector_type = __m128;
+					static constexpr alias::size_type N = 4;
+
+					static vector_type load(float const *p) { return _mm_loadu_ps(p); }
+					static void store(float *p, vector_type a) { _mm_storeu_ps(p, a); }
+					static vector_type set1(float value) { return _mm_set1_ps(value); }
+					static unsigned eq_mask(vector_type a, vector_type b) {
+						return static_cast<unsigned>(_mm_movemask_ps(_mm_cmpeq_ps(a, b)));
+					}
+					static vector_type add(vector_type a, vector_type b) { return _mm_add_ps(a, b); }
+					static vector_type min(vector_type a, vector_type b) { return _mm_min_ps(a, b); }
+					static vector_type max(vector_type a, vector_type b) { return _mm_max_ps(a, b); }
+				};
+
+#include "experimental_simd_kernels.hpp"
+			}
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("avx2")
+			namespace avx2 {
+				template<typename T>
+				struct Lanes;
+
+				template<>
+				struct Lanes<std::int32_t> {
+					using vector_type = __m256i;
+					static constexpr alias::size_type N = 8;
+
+					static vector_type load(std::int32_t const *p) { return _mm256_loadu_si256(reinterpret_cast<__m256i const *>(p)); }
+					static void store(std::int32_t *p, vector_type a) { _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), a); }
+					static vector_type set1(std::int32_t value) { return _mm256_set1_epi32(value); }
+					static unsigned eq_mask(vector_type a, vector_type b) {
+						return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b))));
+					}
+					static vector_type add(vector_type a, vector_type b) { return _mm256_add_epi32(a, b); }
+					static vector_type min(vector_type a, vector_type b) { return _mm256_min_epi32(a, b); }
+					static vector_type max(vector_type a, vector_type b) { return _mm256_max_epi32(a, b); }
+				};
+
+				template<>
+				struct Lanes<float> {
+					using vector_type = __m256;
+					static constexpr alias::size_type N = 8;
+
+					static vector_type load(float const *p) { return _mm256_loadu_ps(p); }
+					static void store(float *p, vector_type a) { _mm256_storeu_ps(p, a); }
+					static vector_type set1(float value) { return _mm256_set1_ps(value); }
+					static unsigned eq_mask(vector_type a, vector_type b) {
+						return static_cast<unsigned>(_mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ)));
+					}
+					static vector_type add(vector_type a, vector_type b) { return _mm256_add_ps(a, b); }
+					static vector_type min(vector_type a, vector_type b) { return _mm256_min_ps(a, b); }
+					static vector_type max(vector_type a, vector_type b) { return _mm256_max_ps(a, b); }
+				};
+
+#include "experimental_simd_kernels.hpp"
+			}
+#pragma GCC pop_options
+#endif // _EXPERIMENTAL_SIMD_X86_
+
+			// call the kernel 'KERNEL' of the active instruction set, or evaluate 'SCALAR'
+#if _EXPERIMENTAL_SIMD_X86_
+#define _EXPERIMENTAL_SIMD_DISPATCH_(KERNEL, SCALAR)			\
+			switch (simd_level()) {								\
+			case SimdLevel::AVX2: return avx2::KERNEL;			\
+			case SimdLevel::SSE4: return sse4::KERNEL;			\
+			default: return SCALAR;								\
+			}
+#else
+#define _EXPERIMENTAL_SIMD_DISPATCH_(KERNEL, SCALAR) return SCALAR;
+#endif
+
+			template<typename T>
+			alias::size_type find(T const *p, alias::size_type n, T value) {
+				_EXPERIMENTAL_SIMD_DISPATCH_(find(p, n, value), static_cast<alias::size_type>(std::find(p, p + n, value) - p))
+			}
+
+			template<typename T>
+			alias::size_type find_last(T const *p, alias::size_type n, T value) {
+				auto scalar = [&]() {
+					for (alias::size_type i = n; i > 0; --i) {
+						if (p[i - 1] == value) {
+							return i - 1;
+						}
+					}
+					return n;
+				};
+				_EXPERIMENTAL_SIMD_DISPATCH_(find_last(p, n, value), scalar())
+			}
+
+			template<typename T>
+			alias::size_type count(T const *p, alias::size_type n, T value) {
+				_EXPERIMENTAL_SIMD_DISPATCH_(count(p, n, value), static_cast<alias::size_type>(std::count(p, p + n, value)))
+			}
+
+			template<typename T>
+			void min_max(T const *p, alias::size_type n, T &minValue, T &maxValue) {
+				auto scalar = [&]() {
+					minValue = maxValue = p[0];
+					for (alias::size_type i = 1; i < n; ++i) {
+						minValue = p[i] < minValue ? p[i] : minValue;
+						maxValue = maxValue < p[i] ? p[i] : maxValue;
+					}
+				};
+				_EXPERIMENTAL_SIMD_DISPATCH_(min_max(p, n, minValue, maxValue), scalar())
+			}
+
+			template<typename T>
+			T sum(T const *p, alias::size_type n, T init) {
+				auto scalar = [&]() {
+					for (alias::size_type i = 0; i < n; ++i) {
+						init += p[i];
+					}
+					return init;
+				};
+				_EXPERIMENTAL_SIMD_DISPATCH_(sum(p, n, init), scalar())
+			}
+
+			template<typename T>
+			bool equal(T const *p, T const *q, alias::size_type n) {
+				if constexpr (std::is_integral<T>::value) {
+					// integers are equal if their bytes are, memcmp is vectorized by the C library
+					return n == 0 || std::memcmp(p, q, n * sizeof(T)) == 0;
+				}
+				else {
+					_EXPERIMENTAL_SIMD_DISPATCH_(equal(p, q, n), std::equal(p, p + n, q))
+				}
+			}
+
+#undef _EXPERIMENTAL_SIMD_DISPATCH_
+
+			// convert 'value' to the element type 'E' in 'e' for the kernels,
+			// false if the conversion does not keep the value: the kernels would then compare another value
+			// than 'element == value' does, so the scalar loop has to run
+			template<typename E, typename T>
+			bool to_element(T const &value, E &e) {
+				if constexpr (std::is_same<T, E>::value) {
+					e = value;
+					return true;
+				}
+				else if constexpr (std::is_arithmetic<T>::value) {
+					if constexpr (std::is_floating_point<T>::value && std::is_integral<E>::value) {
+						// a floating value out of the range of the integer (or NaN) has no conversion
+						if (!(value > static_cast<T>(std::numeric_limits<E>::min()) - 1
+							  && value < static_cast<T>(std::numeric_limits<E>::max()) + 1)) {
+							return false;
+						}
+					}
+					e = static_cast<E>(value);
+					return static_cast<T>(e) == value;
+				}
+				else {
+					return false;
+				}
+			}
+
+			// check if 'element == value' as the scalar loops of find() and count() do:
+			// arithmetic values are compared in their common type, which is what == converts them to,
+			// so an int element against an unsigned value keeps its meaning without -Wsign-compare
+			template<typename E, typename T>
+			bool equals(E const &element, T const &value) {
+				if constexpr (std::is_arithmetic<E>::value && std::is_arithmetic<T>::value) {
+					using common_type = std::common_type_t<E, T>;
+					return static_cast<common_type>(element) == static_cast<common_type>(value);
+				}
+				else {
+					return element == value;
+				}
+			}
+
+			// check if 'Container' stores its elements contiguously: it provides data() and size()
+			template<typename Container, typename = void>
+			struct is_contiguous_container : std::false_type {};
+
+			template<typename Container>
+			struct is_contiguous_container<Container, std::void_t<decltype(std::declval<Container &>().data()),
+																   decltype(std::declval<Container &>().size())>>
+				: std::true_type {};
+
+			template<typename Container>
+			using enable_if_contiguous_t = std::enable_if_t<is_contiguous_container<Container>::value>;
+		}
+
+		/*	Vectorized algorithms
+			Ranges of pointers to int32_t or float run vectorized kernels with the instruction set
+			chosen at run time (see simd_level()), other ranges run the equivalent scalar loop.
+			The overloads taking a container with data() and size() (Vector, SmallVector, std::vector...)
+			run the kernels on its elements and return iterators of the container.
+			Note:
+			- accumulate() adds floats in another order than the scalar loop, the sum may differ by rounding.
+			- minmax_element() on floats is unspecified if the range holds NaN.
+			- equal() compares integers with memcmp, which the C library already vectorizes.
+			- find() and count() run the scalar loop if 'value' changes when converted to the element type
+			  (1.5 or 2^32 + 1 against int32_t, 0.1 against floats), so they always agree with std::find and std::count.
+		*/
+
+		// get the first element equal to 'value' in [first, last), last if there is none
+		template<typename InputIterator, typename T>
+		InputIterator find(InputIterator first, InputIterator last, T const &value) {
+			if constexpr (details::is_vectorizable_v<InputIterator>) {
+				using value_type = std::remove_cv_t<std::remove_pointer_t<InputIterator>>;
+				value_type e;
+				if (details::to_element(value, e)) {
+					return first + details::find<value_type>(first, static_cast<alias::size_type>(last - first), e);
+				}
+			}
+			for (; first != last && !details::equals(*first, value); ++first) {}
+			return first;
+		}
+
+		// count the elements equal to 'value' in [first, last)
+		template<typename InputIterator, typename T>
+		alias::size_type count(InputIterator first, InputIterator last, T const &value) {
+			if constexpr (details::is_vectorizable_v<InputIterator>) {
+				using value_type = std::remove_cv_t<std::remove_pointer_t<InputIterator>>;
+				value_type e;
+				if (details::to_element(value, e)) {
+					return details::count<value_type>(first, static_cast<alias::size_type>(last - first), e);
+				}
+			}
+			alias::size_type total = 0;
+			for (; first != last; ++first) {
+				total += details::equals(*first, value);
+			}
+			return total;
+		}
+
+		// get the first smallest and the last greatest elements of [first, last),
+		// {last, last} if the range is empty
+		template<typename ForwardIterator>
+		std::pair<ForwardIterator, ForwardIterator> minmax_element(ForwardIterator first, ForwardIterator last) {
+			if (first == last) {
+				return { last, last };
+			}
+			if constexpr (details::is_vectorizable_v<ForwardIterator>) {
+				// the extreme values in one pass, then their positions
+				using value_type = std::remove_cv_t<std::remove_pointer_t<ForwardIterator>>;
+				alias::size_type n = static_cast<alias::size_type>(last - first);
+				value_type minValue, maxValue;
+				details::min_max<value_type>(first, n, minValue, maxValue);
+				return { first + details::find<value_type>(first, n, minValue),
+						 first + details::find_last<value_type>(first, n, maxValue) };
+			}
+			else {
+				ForwardIterator low = first, high = first;
+				for (++first; first != last; ++first) {
+					if (*first < *low) {
+						low = first;
+					}
+					if (!(*first < *high)) {
+						high = first;
+					}
+				}
+				return { low, high };
+			}
+		}
+
+		// add up the elements of [first, last) to 'init'
+		template<typename InputIterator, typename T>
+		T accumulate(InputIterator first, InputIterator last, T init) {
+			if constexpr (details::is_vectorizable_v<InputIterator>
+						  && std::is_same<T, std::remove_cv_t<std::remove_pointer_t<InputIterator>>>::value) {
+				using value_type = T;
+				return details::sum<value_type>(first, static_cast<alias::size_type>(last - first), init);
+			}
+			else {
+				for (; first != last; ++first) {
+					init = std::move(init) + *first;
+				}
+				return init;
+			}
+		}
+
+		// check if [first1, last1) and the range starting at first2 are equal element-wise
+		template<typename InputIterator1, typename InputIterator2>
+		bool equal(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2) {
+			if constexpr (details::is_vectorizable_v<InputIterator1>
+						  && std::is_same<std::remove_cv_t<std::remove_pointer_t<InputIterator1>>,
+										  std::remove_cv_t<std::remove_pointer_t<InputIterator2>>>::value) {
+				using value_type = std::remove_cv_t<std::remove_pointer_t<InputIterator1>>;
+				return details::equal<value_type>(first1, first2, static_cast<alias::size_type>(last1 - first1));
+			}
+			else {
+				for (; first1 != last1; ++first1, ++first2) {
+					if (!(*first1 == *first2)) {
+						return false;
+					}
+				}
+				return true;
+			}
+		}
+
+		/*	Branchless lower_bound: get the first element of the sorted [first, last)
+			that is not less than 'value', last if there is none
+			The search halves the range with a conditional move instead of a branch,
+			so it does not pay for the unpredictable branch of the binary search,
+			and it prefetches both possible next probes.
+			Requirement: random access iterators
+		*/
+		template<typename RandomAccessIterator, typename T, typename Comparator = std::less<>>
+		RandomAccessIterator lower_bound(RandomAccessIterator first, RandomAccessIterator last, T const &value, Comparator cmp = Comparator()) {
+			using difference_type = typename std::iterator_traits<RandomAccessIterator>::difference_type;
+			if (first == last) {
+				return first;
+			}
+			difference_type n = last - first;
+			RandomAccessIterator base = first;
+			while (n > 1) {
+				difference_type half = n / 2;
+#if defined(__GNUC__)
+				__builtin_prefetch(&*(base + half / 2));
+				__builtin_prefetch(&*(base + half + half / 2));
+#endif
+				base = cmp(base[half], value) ? base + half : base;
+				n -= half;
+			}
+			return base + static_cast<difference_type>(cmp(*base, value));
+		}
+
+		/* Container overloads */
+		// ===============================================================================
+
+		namespace details {
+			// get the iterator of 'c' to the element at 'p', which may be the end
+			template<typename Container, typename Pointer>
+			auto iterator_at(Container &c, Pointer p) -> decltype(c.begin()) {
+				auto idx = p - c.data();
+				return idx == static_cast<decltype(idx)>(c.size()) ? c.end() : c.begin() + idx;
+			}
+		}
+
+		template<typename Container, typename T, typename = details::enable_if_contiguous_t<Container>>
+		auto find(Container &c, T const &value) -> decltype(c.begin()) {
+			return details::iterator_at(c, find(c.data(), c.data() + c.size(), value));
+		}
+
+		template<typename Container, typename T, typename = details::enable_if_contiguous_t<Container>>
+		alias::size_type count(Container const &c, T const &value) {
+			return count(c.data(), c.data() + c.size(), value);
+		}
+
+		template<typename Container, typename = details::enable_if_contiguous_t<Container>>
+		auto minmax_element(Container &c) -> std::pair<decltype(c.begin()), decltype(c.begin())> {
+			auto extremes = minmax_element(c.data(), c.data() + c.size());
+			return { details::iterator_at(c, extremes.first), details::iterator_at(c, extremes.second) };
+		}
+
+		template<typename Container, typename T, typename = details::enable_if_contiguous_t<Container>>
+		T accumulate(Container const &c, T init) {
+			return accumulate(c.data(), c.data() + c.size(), init);
+		}
+
+		template<typename Container1, typename Container2,
+				 typename = details::enable_if_contiguous_t<Container1>, typename = details::enable_if_contiguous_t<Container2>>
+		bool equal(Container1 const &lhs, Container2 const &rhs) {
+			return lhs.size() == rhs.size() && equal(lhs.data(), lhs.data() + lhs.size(), rhs.data());
+		}
+
+		template<typename Container, typename T>
+		auto lower_bound(Container &c, T const &value) -> decltype(c.begin()) {
+			return lower_bound(c.begin(), c.end(), value);
+		}
+	}
+}
+
+#undef _EXPERIMENTAL_SIMD_X86_
+
+#endif // !_EXPERIMENTAL_SIMD_ALGORITHMS_HPP_
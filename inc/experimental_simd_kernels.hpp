@@ -0,0 +1,147 @@
+/*
+ *	File name:	"experimental_simd_kernels.hpp"
+ *	Date:		10/19/2026 1:36:52 AM
+ *	Author:		Vo, Dinh Tue Minh
+ *	Purpose:	Vectorized kernels of experimental_simd_algorithms.hpp
+ *				This file has no include guard: experimental_simd_algorithms.hpp includes it
+ *				once per instruction set, inside a namespace that provides
+ *					template<typename T> struct Lanes;
+ *				for int32_t and float, and under the matching "#pragma GCC target",
+ *				so that every kernel is compiled for that instruction set.
+ *				A Lanes<T> provides
+ *					size_type N							the number of lanes
+ *					vector_type							the register type
+ *					load(p), set1(value)				unaligned load, broadcast
+ *					eq_mask(a, b)						bit i is set if lane i of a and b are equal
+ *					add(a, b), min(a, b), max(a, b)		lane-wise operations
+ *					store(p, a)							unaligned store
+ */
+
+// get the index of the first element equal to 'value' in p[0, n), n if there is none
+template<typename T>
+alias::size_type find(T const *p, alias::size_type n, T value) {
+	using L = Lanes<T>;
+	typename L::vector_type const needle = L::set1(value);
+	alias::size_type i = 0;
+	for (; i + L::N <= n; i += L::N) {
+		unsigned mask = L::eq_mask(L::load(p + i), needle);
+		if (mask) {
+			return i + static_cast<alias::size_type>(__builtin_ctz(mask));
+		}
+	}
+	for (; i < n; ++i) {
+		if (p[i] == value) {
+			return i;
+		}
+	}
+	return n;
+}
+
+// get the index of the last element equal to 'value' in p[0, n), n if there is none
+template<typename T>
+alias::size_type find_last(T const *p, alias::size_type n, T value) {
+	using L = Lanes<T>;
+	typename L::vector_type const needle = L::set1(value);
+	alias::size_type i = n;
+	for (; i >= L::N; i -= L::N) {
+		unsigned mask = L::eq_mask(L::load(p + i - L::N), needle);
+		if (mask) {
+			return i - L::N + static_cast<alias::size_type>(31 - __builtin_clz(mask));
+		}
+	}
+	while (i > 0) {
+		if (p[--i] == value) {
+			return i;
+		}
+	}
+	return n;
+}
+
+// count the elements equal to 'value' in p[0, n)
+template<typename T>
+alias::size_type count(T const *p, alias::size_type n, T value) {
+	using L = Lanes<T>;
+	typename L::vector_type const needle = L::set1(value);
+	alias::size_type total = 0;
+	alias::size_type i = 0;
+	for (; i + L::N <= n; i += L::N) {
+		total += static_cast<alias::size_type>(__builtin_popcount(L::eq_mask(L::load(p + i), needle)));
+	}
+	for (; i < n; ++i) {
+		total += p[i] == value;
+	}
+	return total;
+}
+
+// get the smallest and the greatest values of p[0, n), n > 0
+template<typename T>
+void min_max(T const *p, alias::size_type n, T &minValue, T &maxValue) {
+	using L = Lanes<T>;
+	minValue = maxValue = p[0];
+	alias::size_type i = 0;
+	if (n >= L::N) {
+		typename L::vector_type low = L::load(p);
+		typename L::vector_type high = low;
+		for (i = L::N; i + L::N <= n; i += L::N) {
+			typename L::vector_type v = L::load(p + i);
+			low = L::min(low, v);
+			high = L::max(high, v);
+		}
+		T lanes[L::N];
+		L::store(lanes, low);
+		for (alias::size_type k = 0; k < L::N; ++k) {
+			minValue = lanes[k] < minValue ? lanes[k] : minValue;
+		}
+		L::store(lanes, high);
+		for (alias::size_type k = 0; k < L::N; ++k) {
+			maxValue = maxValue < lanes[k] ? lanes[k] : maxValue;
+		}
+	}
+	for (; i < n; ++i) {
+		minValue = p[i] < minValue ? p[i] : minValue;
+		maxValue = maxValue < p[i] ? p[i] : maxValue;
+	}
+}
+
+// add up the elements of p[0, n) to 'init'
+// two accumulators hide the latency of the additions
+template<typename T>
+T sum(T const *p, alias::size_type n, T init) {
+	using L = Lanes<T>;
+	typename L::vector_type total0 = L::set1(T{});
+	typename L::vector_type total1 = total0;
+	alias::size_type i = 0;
+	for (; i + 2 * L::N <= n; i += 2 * L::N) {
+		total0 = L::add(total0, L::load(p + i));
+		total1 = L::add(total1, L::load(p + i + L::N));
+	}
+	T lanes[L::N];
+	L::store(lanes, L::add(total0, total1));
+	T total = init;
+	for (alias::size_type k = 0; k < L::N; ++k) {
+		total += lanes[k];
+	}
+	for (; i < n; ++i) {
+		total += p[i];
+	}
+	return total;
+}
+
+// check if p[0, n) and q[0, n) are equal element-wise
+template<typename T>
+bool equal(T const *p, T const *q, alias::size_type n) {
+	using L = Lanes<T>;
+	constexpr unsigned ALL_EQUAL = (1u << L::N) - 1;
+	alias::size_type i = 0;
+	for (; i + L::N <= n; i += L::N) {
+		if (L::eq_mask(L::load(p + i), L::load(q + i)) != ALL_EQUAL) {
+			return false;
+		}
+	}
+	for (; i < n; ++i) {
+		if (!(p[i] == q[i])) {
+			return false;
+		}
+	}
+	return true;
+}
@@ -0,0 +1,34 @@
+/*
+ *	File name:	"experimental_type_traits.hpp"
+ *	Date:		10/18/2026 6:12:47 PM
+ *	Author:		Vo, Dinh Tue Minh
+ *	Purpose:	Type traits used by the containers in the experimental namespace
+ */
+
+#pragma once
+
+#ifndef _EXPERIMENTAL_TYPE_TRAITS_HPP_
+#define _EXPERIMENTAL_TYPE_TRAITS_HPP_
+
+#include <type_traits>
+
+namespace experimental {
+	/*	is_trivially_relocatable trait
+		tells if moving an object to new storage and destroying the old one
+		is equivalent to copying its bytes with memcpy and forgetting the old one.
+		Containers relocate such objects with memcpy/memmove and grow them with realloc.
+		Note:
+		- True for trivially copyable types.
+		- Specialize it to mark other types, e.g. a class owning a heap pointer
+		  that does not point into itself:
+			template<>
+			struct experimental::is_trivially_relocatable<MyType> : std::true_type {};
+	*/
+	template<typename T>
+	struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+	template<typename T>
+	constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+}
+
+#endif // !_EXPERIMENTAL_TYPE_TRAITS_HPP_
@@ -11,6 +11,7 @@
 #include "../experimental_alias_declarations.hpp"
 
 #include <functional>
+#include <iterator>
 #include <utility>
 
 namespace experimental {
@@ -27,7 +28,7 @@ namespace experimental {
 		void insertion_sort_imp(Iterator first,
 								Iterator last,
 								Comparator cmp) {
-			using value_type = typename Iterator::value_type;
+			using value_type = typename std::iterator_traits<Iterator>::value_type;
 			using size_type = alias::size_type;
 
 			for (Iterator i = first; i != last; ++i) {
@@ -72,7 +73,7 @@ namespace experimental {
 	 *
 	 *  Requirement: The Container must support random access.
 	 */
-	template<typename Iterator, typename Comparator = std::less<typename Iterator::value_type>>
+	template<typename Iterator, typename Comparator = std::less<typename std::iterator_traits<Iterator>::value_type>>
 	void insertion_sort(Iterator first, Iterator last, Comparator cmp = Comparator()) {
 		if (first != last) {
 			details::insertion_sort_imp(first, last, cmp);
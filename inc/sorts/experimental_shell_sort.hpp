@@ -75,7 +75,7 @@ namespace experimental {
 	 *	cmp: the Comparator
 	 */
 	template<typename T, typename Comparator = std::less<T>>
-	inline void shell_sort(T *arr, alias::size_type sz, Comparator cmp = Compartor()) {
+	inline void shell_sort(T *arr, alias::size_type sz, Comparator cmp = Comparator()) {
 		details::shell_sort_imp(arr, sz, cmp);
 	}
 }
@@ -0,0 +1,197 @@
+/*
+ *	File name:	"allocation_tracker.cpp"
+ *	Date:		10/18/2026 3:22:36 PM
+ *	Author:		Vo, Dinh Tue Minh
+ *	Purpose:	Implement the allocation tracker by replacing
+ *				the global operator new/delete
+ */
+
+#include "./inc/allocation_tracker.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <new>
+#include <string>
+
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
+namespace {
+	// the counters are only touched while the tracking is enabled,
+	// so that the other allocations of the program do not pay for them
+	std::atomic<bool> trackingEnabled{ false };
+
+	std::atomic<long long> allocations{ 0 };
+	std::atomic<long long> deallocations{ 0 };
+	std::atomic<long long> currentBytes{ 0 };
+	std::atomic<long long> peakBytes{ 0 };
+
+	// every block starts with a header holding its size if it was counted, 0 otherwise,
+	// so that operator delete knows how many bytes are released
+	constexpr std::size_t HEADER_SIZE = alignof(std::max_align_t);
+
+	void* tracked_allocate(std::size_t sz) noexcept {
+		void *p = std::malloc(sz + HEADER_SIZE);
+		if (!p) {
+			return nullptr;
+		}
+		if (!trackingEnabled.load(std::memory_order_relaxed)) {
+			*static_cast<std::size_t *>(p) = 0;
+			return static_cast<char *>(p) + HEADER_SIZE;
+		}
+		*static_cast<std::size_t *>(p) = sz;
+
+		allocations.fetch_add(1, std::memory_order_relaxed);
+		long long current = currentBytes.fetch_add(static_cast<long long>(sz), std::memory_order_relaxed) + static_cast<long long>(sz);
+		long long peak = peakBytes.load(std::memory_order_relaxed);
+		while (current > peak && !peakBytes.compare_exchange_weak(peak, current, std::memory_order_relaxed)) {}
+
+		return static_cast<char *>(p) + HEADER_SIZE;
+	}
+
+	void tracked_deallocate(void *p) noexcept {
+		if (!p) {
+			return;
+		}
+		void *block = static_cast<char *>(p) - HEADER_SIZE;
+		// a counted block is released from the current bytes even if the tracking stopped since
+		if (std::size_t sz = *static_cast<std::size_t *>(block)) {
+			deallocations.fetch_add(1, std::memory_order_relaxed);
+			currentBytes.fetch_sub(static_cast<long long>(sz), std::memory_order_relaxed);
+		}
+		std::free(block);
+	}
+
+	void* throwing_allocate(std::size_t sz) {
+		if (sz == 0) {
+			sz = 1;
+		}
+		while (true) {
+			if (void *p = tracked_allocate(sz)) {
+				return p;
+			}
+			if (std::new_handler handler = std::get_new_handler()) {
+				handler();
+			}
+			else {
+				throw std::bad_alloc{};
+			}
+		}
+	}
+}
+
+/* Replacement of the global operator new/delete */
+// ==============================================================================
+// the aligned overloads are not replaced, they stay untracked
+
+void* operator new(std::size_t sz) {
+	return throwing_allocate(sz);
+}
+
+void* operator new[](std::size_t sz) {
+	return throwing_allocate(sz);
+}
+
+void* operator new(std::size_t sz, std::nothrow_t const &) noexcept {
+	return tracked_allocate(sz == 0 ? 1 : sz);
+}
+
+void* operator new[](std::size_t sz, std::nothrow_t const &) noexcept {
+	return tracked_allocate(sz == 0 ? 1 : sz);
+}
+
+void operator delete(void *p) noexcept {
+	tracked_deallocate(p);
+}
+
+void operator delete[](void *p) noexcept {
+	tracked_deallocate(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept {
+	tracked_deallocate(p);
+}
+
+void operator delete[](void *p, std::size_t) noexcept {
+	tracked_deallocate(p);
+}
+
+void operator delete(void *p, std::nothrow_t const &) noexcept {
+	tracked_deallocate(p);
+}
+
+void operator delete[](void *p, std::nothrow_t const &) noexcept {
+	tracked_deallocate(p);
+}
+
+AllocationStats allocation_stats() noexcept {
+	return { allocations.load(std::memory_order_relaxed),
+			 deallocations.load(std::memory_order_relaxed),
+			 currentBytes.load(std::memory_order_relaxed),
+			 peakBytes.load(std::memory_order_relaxed) };
+}
+
+void set_allocation_tracking(bool enabled) noexcept {
+	trackingEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+void reset_allocation_peak() noexcept {
+	peakBytes.store(currentBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+#ifdef __linux__
+
+namespace {
+	// read "<key> <value> kB" from /proc/self/status
+	long long read_status_kb(std::string const &key) {
+		std::ifstream status("/proc/self/status");
+		for (std::string word; status >> word;) {
+			if (word == key) {
+				long long kb;
+				if (status >> kb) {
+					return kb * 1024;
+				}
+				break;
+			}
+		}
+		return -1;
+	}
+}
+
+long long current_rss_bytes() {
+	std::ifstream statm("/proc/self/statm");
+	long long totalPages, residentPages;
+	if (statm >> totalPages >> residentPages) {
+		return residentPages * sysconf(_SC_PAGESIZE);
+	}
+	return -1;
+}
+
+bool reset_peak_rss() {
+	// writing 5 resets VmHWM since Linux 4.0
+	std::ofstream clearRefs("/proc/self/clear_refs");
+	return clearRefs && (clearRefs << '5') && clearRefs.flush();
+}
+
+long long peak_rss_bytes() {
+	return read_status_kb("VmHWM:");
+}
+
+#else
+
+long long current_rss_bytes() {
+	return -1;
+}
+
+bool reset_peak_rss() {
+	return false;
+}
+
+long long peak_rss_bytes() {
+	return -1;
+}
+
+#endif
@@ -7,11 +7,10 @@
 
 #include "./inc/random_generator.hpp"
 #include "./inc/benchmark.hpp"
+#include "./inc/benchmark_registry.hpp"
+#include "./inc/hardware_counters.hpp"
+#include "./inc/allocation_tracker.hpp"
 #include "../inc/experimental_alias_declarations.hpp"
-#include "../inc/sorts/experimental_heap_sort.hpp"
-#include "../inc/sorts/experimental_merge_sort.hpp"
-#include "../inc/sorts/experimental_quick_sort.hpp"
-#include "../inc/sorts/experimental_shell_sort.hpp"
 
 #include <cstring>
 #include <chrono>
@@ -19,6 +18,10 @@
 #include <sstream>
 #include <fstream>
 #include <iostream>
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+#include <vector>
 
 using namespace experimental;
 
@@ -30,14 +33,17 @@ long long calculate_running_time(int *arr, unsigned int sz, void (*sort)(int *,
 	return std::chrono::duration_cast<std::chrono::microseconds>(stop - start).count();
 }
 
-int* read_data_from_file(std::string const &fileName, unsigned int const SIZE) {
-	int *arr = nullptr;
+// read a sample file whose first number is its size
+// return nullptr if the file cannot be read or its size is not SIZE
+template<typename T>
+T* read_data_from_file(std::string const &fileName, unsigned int const SIZE) {
+	T *arr = nullptr;
 	unsigned int sz = 0;
 	std::ifstream data(fileName);
 	if (data) {
 		data >> sz;
 		if (sz == SIZE) {
-			arr = new int[sz];
+			arr = new T[sz];
 			for (unsigned int i = 0; i < sz; ++i) {
 				data >> arr[i];
 			}
@@ -47,271 +53,434 @@ int* read_data_from_file(std::string const &fileName, unsigned int const SIZE) {
 	return arr;
 }
 
-long long benchmark(int *arr, unsigned const int sz, void (*sort)(int *arr, alias::size_type, std::less<int>)) {
-	int *cpy = new int[sz];
-	memcpy(cpy, arr, sizeof(int) * sz);
+// measurements of one sorting call
+// the memory is measured from the sorted copy, so the copy itself is not included
+struct BenchmarkResult {
+	long long microseconds;
+	HardwareCounterValues counters;
+	long long peakExtraBytes;	// peak of the bytes allocated by the sort
+	long long allocations;		// calls to operator new by the sort
+	long long rssDeltaBytes;	// growth of the (peak) resident set size, -1 if unknown
+};
 
+// sort a copy of 'arr' and measure the call
+// the hardware counters are read only if 'counters' is not null
+// the memory is tracked only if 'trackMemory' is true
+template<typename T>
+BenchmarkResult benchmark(T *arr, unsigned const int sz, void (*sort)(T *arr, alias::size_type, std::less<T>), HardwareCounters *counters = nullptr, bool trackMemory = false) {
+	T *cpy = new T[sz];
+	memcpy(cpy, arr, sizeof(T) * sz);
+
+	BenchmarkResult result{};
+	AllocationStats allocationsBefore{};
+	long long rssBefore = -1;
+	bool peakRssReset = false;
+	if (trackMemory) {
+		rssBefore = current_rss_bytes();
+		peakRssReset = reset_peak_rss();
+		// reading the RSS allocates, so snapshot the allocations last
+		set_allocation_tracking(true);
+		reset_allocation_peak();
+		allocationsBefore = allocation_stats();
+	}
+	if (counters) {
+		counters->start();
+	}
 	auto start = std::chrono::high_resolution_clock::now();
-	sort(cpy, sz, std::less<int>());
+	sort(cpy, sz, std::less<T>());
 	auto stop = std::chrono::high_resolution_clock::now();
+	if (counters) {
+		result.counters = counters->stop();
+	}
+	if (trackMemory) {
+		AllocationStats allocationsAfter = allocation_stats();
+		set_allocation_tracking(false);
+		result.peakExtraBytes = allocationsAfter.peakBytes - allocationsBefore.currentBytes;
+		result.allocations = allocationsAfter.allocations - allocationsBefore.allocations;
+		// a buffer freed before returning is only seen by the peak
+		long long rssAfter = peakRssReset ? peak_rss_bytes() : current_rss_bytes();
+		result.rssDeltaBytes = rssBefore < 0 || rssAfter < 0 ? -1 : rssAfter - rssBefore;
+	}
 
 	delete[] cpy;
 
-	return std::chrono::duration_cast<std::chrono::microseconds>(stop - start).count();
+	result.microseconds = std::chrono::duration_cast<std::chrono::microseconds>(stop - start).count();
+	return result;
 }
 
-void benchmark_sorting_algorithms() {
-	puts("Start benchmarking ...\n");
-	std::ofstream heapSortOutput("heap_sort_benchmark_result.txt");
-	std::ofstream mergeSortOutput("merge_sort_benchmark_result.txt");
-	std::ofstream quickSortOutput("quick_sort_benchmark_result.txt");
-	std::ofstream shellSortOutput("shell_sort_benchmark_result.txt");
-	if (!heapSortOutput || !mergeSortOutput || !quickSortOutput || !shellSortOutput) {
-		puts("Cannot open output files.");
-		heapSortOutput.close();
-		mergeSortOutput.close();
-		quickSortOutput.close();
-		shellSortOutput.close();
-		return;
+// sort a Counted<int> copy of 'arr' and count the operations
+// the sort is not timed since the counting slows it down
+OperationCounts count_operations(int *arr, unsigned const int sz, counted_sort_function sort) {
+	Counted<int> *cpy = new Counted<int>[sz];
+	for (unsigned int i = 0; i < sz; ++i) {
+		cpy[i] = Counted<int>{ arr[i] };
 	}
-	// lambda to write data to all output files
-	auto write_to_all = [&heapSortOutput, &mergeSortOutput, &quickSortOutput, &shellSortOutput](std::string const &data) {
-		heapSortOutput << data;
-		mergeSortOutput << data;
-		quickSortOutput << data;
-		shellSortOutput << data;
-	};
-	auto benchmark_and_write_all = [&heapSortOutput, &mergeSortOutput, &quickSortOutput, &shellSortOutput](int *arr, unsigned int const arrSize) {
-		heapSortOutput << benchmark(arr, arrSize, heap_sort) << ' ';
-		mergeSortOutput << benchmark(arr, arrSize, merge_sort) << ' ';
-		quickSortOutput << benchmark(arr, arrSize, quick_sort) << ' ';
-		shellSortOutput << benchmark(arr, arrSize, shell_sort) << ' ';
-	};
 
-	int *arr = nullptr;
-
-	/* SMALL KEYS */
-	write_to_all("Small keys:\n");
-	for (unsigned int iSz = 0, nSz = sizeof(SAMPLE_SIZES) / sizeof(SAMPLE_SIZES[0]); iSz < nSz; ++iSz) {
-		unsigned int const sz = SAMPLE_SIZES[iSz];
-		write_to_all('\t' + std::to_string(sz) + ":\n");
-		{
-			/* SORTED */
-			write_to_all("\t\tSorted: ");
-			for (unsigned int iSample = 1; iSample <= NUMBER_OF_SAMPLES; ++iSample) {
-				// generate sample file name
-				std::ostringstream oss;
-				oss << "./data/sortings/small_keys_" << sz << '_' << iSample << "_sorted.txt";
-				std::string fileName = oss.str();
-				std::cout << "Benchmarking " << fileName << '\n';
-				int *arr = read_data_from_file(fileName, sz);
-				if (arr) {
-					benchmark_and_write_all(arr, sz);
-					std::cout << "Finished benchmarking " << fileName << '\n';
-				}
-				else {
-					std::cout << "Error " << fileName << '\n';
-				}
+	operation_counts().reset();
+	sort(cpy, sz, std::less<Counted<int>>());
+	OperationCounts counts = operation_counts();
+
+	delete[] cpy;
+
+	return counts;
+}
+
+namespace {
+	// split 'value' by ','
+	std::vector<std::string> split_list(std::string const &value) {
+		std::vector<std::string> items;
+		std::istringstream iss(value);
+		for (std::string item; std::getline(iss, item, ',');) {
+			if (!item.empty()) {
+				items.push_back(item);
 			}
-			write_to_all("\n");
-
-			/* REVERSED SORTED */
-			write_to_all("\t\tReversed sorted: ");
-			for (unsigned int iSample = 1; iSample <= NUMBER_OF_SAMPLES; ++iSample) {
-				// generate sample file name
-				std::ostringstream oss;
-				oss << "./data/sortings/small_keys_" << sz << '_' << iSample << "_reversed_sorted.txt";
-				std::string fileName = oss.str();
-				std::cout << "Benchmarking " << fileName << '\n';
-				int *arr = read_data_from_file(fileName, sz);
-				if (arr) {
-					benchmark_and_write_all(arr, sz);
-					std::cout << "Finished benchmarking " << fileName << '\n';
-				}
-				else {
-					std::cout << "Error " << fileName << '\n';
-				}
+		}
+		return items;
+	}
+
+	// parse "<low>..<high>" or "<size>", sizes may use scientific notation, e.g. 1e6
+	bool parse_size_range(std::string const &value, std::pair<double, double> &range) {
+		try {
+			auto dots = value.find("..");
+			if (dots == std::string::npos) {
+				range.first = range.second = std::stod(value);
 			}
-			write_to_all("\n");
-
-			/* ALMOST SORTED */
-			write_to_all("\t\tAlmost sorted: ");
-			for (unsigned int iSample = 1; iSample <= NUMBER_OF_SAMPLES; ++iSample) {
-				// generate sample file name
-				std::ostringstream oss;
-				oss << "./data/sortings/small_keys_" << sz << '_' << iSample << "_almost_sorted.txt";
-				std::string fileName = oss.str();
-				std::cout << "Benchmarking " << fileName << '\n';
-				int *arr = read_data_from_file(fileName, sz);
-				if (arr) {
-					benchmark_and_write_all(arr, sz);
-					std::cout << "Finished benchmarking " << fileName << '\n';
-				}
-				else {
-					std::cout << "Error " << fileName << '\n';
-				}
+			else {
+				range.first = dots == 0 ? 0.0 : std::stod(value.substr(0, dots));
+				range.second = dots + 2 == value.size() ? std::numeric_limits<double>::max() : std::stod(value.substr(dots + 2));
 			}
-			write_to_all("\n");
-
-			/* RANDOM */
-			write_to_all("\t\tRandom: ");
-			for (unsigned int iSample = 1; iSample <= NUMBER_OF_SAMPLES; ++iSample) {
-				// generate sample file name
-				std::ostringstream oss;
-				oss << "./data/sortings/small_keys_" << sz << '_' << iSample << "_random.txt";
-				std::string fileName = oss.str();
-				std::cout << "Benchmarking " << fileName << '\n';
-				int *arr = read_data_from_file(fileName, sz);
-				if (arr) {
-					benchmark_and_write_all(arr, sz);
-					std::cout << "Finished benchmarking " << fileName << '\n';
-				}
-				else {
-					std::cout << "Error " << fileName << '\n';
-				}
+		}
+		catch (std::exception const &) {
+			return false;
+		}
+		return range.first <= range.second;
+	}
+
+	// check if 'name' is selected by the filter
+	// an empty filter selects everything
+	bool is_selected(std::vector<std::string> const &filter, std::string const &name) {
+		return filter.empty() || std::find(filter.begin(), filter.end(), name) != filter.end();
+	}
+
+	bool is_selected(std::vector<std::string> const &filter, DataShape const &shape) {
+		return is_selected(filter, shape.name) 
+			|| is_selected(filter, shape.family) 
+			|| is_selected(filter, shape.family + '/' + shape.name);
+	}
+
+	bool is_selected(std::vector<std::pair<double, double>> const &filter, unsigned int sz) {
+		return filter.empty() || std::any_of(filter.begin(), filter.end(), [sz](std::pair<double, double> const &range) {
+			return range.first <= sz && sz <= range.second;
+		});
+	}
+
+	// format the counters summed over 'elements' sorted elements
+	// e.g. "[IPC 1.52, branch-misses/elem 0.41, ...]"
+	std::string format_counters(HardwareCounterValues const &counters, double elements) {
+		std::ostringstream oss;
+		oss << "[IPC " << counters.ipc();
+		for (int i = BRANCH_MISSES; i < HARDWARE_EVENT_COUNT; ++i) {
+			if (counters.valid[i]) {
+				oss << ", " << HARDWARE_EVENT_NAMES[i] << "/elem " << counters.values[i] / elements;
 			}
-			write_to_all("\n");
+		}
+		oss << ']';
+		return oss.str();
+	}
+
+	// format the operation counts summed over 'runs' sorting calls
+	// e.g. "{comparisons 1234.5, copies 0, moves 567, swaps 89.2}"
+	std::string format_operation_counts(OperationCounts const &counts, double runs) {
+		std::ostringstream oss;
+		oss << "{comparisons " << counts.comparisons / runs
+			<< ", copies " << counts.copies / runs
+			<< ", moves " << counts.moves / runs
+			<< ", swaps " << counts.swaps / runs << '}';
+		return oss.str();
+	}
+
+	// memory measurements summed over sorting calls
+	struct MemorySums {
+		long long peakExtraBytes = 0;
+		long long allocations = 0;
+		long long rssDeltaBytes = 0;
+		bool rssKnown = true;
 
+		void add(BenchmarkResult const &result) {
+			peakExtraBytes += result.peakExtraBytes;
+			allocations += result.allocations;
+			rssDeltaBytes += result.rssDeltaBytes;
+			rssKnown = rssKnown && result.rssDeltaBytes >= 0;
 		}
+	};
+
+	// format the memory measurements summed over 'runs' sorting calls
+	// e.g. "<peak +40000 B, allocations 1, RSS +40960 B>"
+	std::string format_memory(MemorySums const &sums, double runs) {
+		std::ostringstream oss;
+		oss << std::fixed;
+		oss.precision(0);
+		oss << "<peak +" << sums.peakExtraBytes / runs << " B, allocations " << sums.allocations / runs;
+		if (sums.rssKnown) {
+			oss << ", RSS " << std::showpos << sums.rssDeltaBytes / runs << std::noshowpos << " B";
+		}
+		oss << '>';
+		return oss.str();
 	}
 
-	/* UNIQUE KEYS */
-	write_to_all("Unique keys:\n");
-	for (unsigned int iSz = 0, nSz = sizeof(SAMPLE_SIZES) / sizeof(SAMPLE_SIZES[0]); iSz < nSz; ++iSz) {
-		unsigned int const sz = SAMPLE_SIZES[iSz];
-		write_to_all('\t' + std::to_string(sz) + ":\n");
-		{
-			/* SORTED */
-			write_to_all("\t\tSorted: ");
-			for (unsigned int iSample = 1; iSample <= NUMBER_OF_SAMPLES; ++iSample) {
-				// generate sample file name
-				std::ostringstream oss;
-				oss << "./data/sortings/unique_keys_" << sz << '_' << iSample << "_sorted.txt";
-				std::string fileName = oss.str();
-				std::cout << "Benchmarking " << fileName << '\n';
-				int *arr = read_data_from_file(fileName, sz);
-				if (arr) {
-					benchmark_and_write_all(arr, sz);
-					std::cout << "Finished benchmarking " << fileName << '\n';
-				}
-				else {
-					std::cout << "Error " << fileName << '\n';
-				}
+	// format the capabilities of 'algorithm', e.g. "stable, needs buffer"
+	std::string format_capabilities(SortAlgorithm const &algorithm) {
+		std::string capabilities;
+		auto add = [&capabilities](char const *capability) {
+			capabilities += capabilities.empty() ? capability : std::string(", ") + capability;
+		};
+		if (algorithm.stable) {
+			add("stable");
+		}
+		if (algorithm.inPlace) {
+			add("in-place");
+		}
+		if (algorithm.needsBuffer) {
+			add("needs buffer");
+		}
+		return capabilities.empty() ? "none" : capabilities;
+	}
+
+	// check if 'algorithm' has the capabilities required by 'options'
+	bool has_capabilities(BenchmarkOptions const &options, SortAlgorithm const &algorithm) {
+		return (!options.stableOnly || algorithm.stable)
+			&& (!options.inPlaceOnly || algorithm.inPlace)
+			&& (!options.noBufferOnly || !algorithm.needsBuffer);
+	}
+
+	void print_usage(char const *program) {
+		std::cout << "Usage: " << program << " [--algo=<names>] [--size=<sizes>] [--shape=<shapes>] [--stable] [--in-place] [--no-buffer]"
+			<< " [--counters] [--counts] [--memory]\n"
+			<< "\t--algo=quick,merge\t\tregistered algorithms:\n";
+		for (auto const &algorithm : sort_algorithm_registry()) {
+			std::cout << "\t\t" << algorithm.name << " (" << format_capabilities(algorithm) << ")\n";
+		}
+		std::cout << "\t--size=1e6..1e8,1000\t\tinclusive ranges or exact sizes\n"
+			<< "\t--shape=random,unique_keys/sorted\tshape names, families or <family>/<name>\n"
+			<< "\t--stable\t\t\tonly the stable algorithms\n"
+			<< "\t--in-place\t\t\tonly the in-place algorithms\n"
+			<< "\t--no-buffer\t\t\tonly the algorithms without an n-element buffer\n"
+			<< "\t--counters\t\t\tcollect hardware performance counters\n"
+			<< "\t--counts\t\t\tcount comparisons, copies, moves and swaps\n"
+			<< "\t--memory\t\t\ttrack heap allocations and resident set size\n";
+	}
+}
+
+bool parse_benchmark_options(int argc, char const *const *argv, BenchmarkOptions &options) {
+	for (int i = 1; i < argc; ++i) {
+		std::string arg = argv[i];
+		auto eq = arg.find('=');
+		std::string key = arg.substr(0, eq);
+		std::string value = eq == std::string::npos ? std::string{} : arg.substr(eq + 1);
+		if (key == "--algo") {
+			for (auto const &name : split_list(value)) {
+				options.algorithms.push_back(name);
 			}
-			write_to_all("\n");
-
-			/* REVERSED SORTED */
-			write_to_all("\t\tReversed sorted: ");
-			for (unsigned int iSample = 1; iSample <= NUMBER_OF_SAMPLES; ++iSample) {
-				// generate sample file name
-				std::ostringstream oss;
-				oss << "./data/sortings/unique_keys_" << sz << '_' << iSample << "_reversed_sorted.txt";
-				std::string fileName = oss.str();
-				std::cout << "Benchmarking " << fileName << '\n';
-				int *arr = read_data_from_file(fileName, sz);
-				if (arr) {
-					benchmark_and_write_all(arr, sz);
-					std::cout << "Finished benchmarking " << fileName << '\n';
-				}
-				else {
-					std::cout << "Error " << fileName << '\n';
-				}
+		}
+		else if (key == "--shape") {
+			for (auto const &name : split_list(value)) {
+				options.shapes.push_back(name);
 			}
-			write_to_all("\n");
-
-			/* ALMOST SORTED */
-			write_to_all("\t\tAlmost sorted: ");
-			for (unsigned int iSample = 1; iSample <= NUMBER_OF_SAMPLES; ++iSample) {
-				// generate sample file name
-				std::ostringstream oss;
-				oss << "./data/sortings/unique_keys_" << sz << '_' << iSample << "_almost_sorted.txt";
-				std::string fileName = oss.str();
-				std::cout << "Benchmarking " << fileName << '\n';
-				int *arr = read_data_from_file(fileName, sz);
-				if (arr) {
-					benchmark_and_write_all(arr, sz);
-					std::cout << "Finished benchmarking " << fileName << '\n';
-				}
-				else {
-					std::cout << "Error " << fileName << '\n';
+		}
+		else if (key == "--size") {
+			for (auto const &item : split_list(value)) {
+				std::pair<double, double> range;
+				if (!parse_size_range(item, range)) {
+					std::cout << "Invalid size: " << item << '\n';
+					return false;
 				}
+				options.sizes.push_back(range);
 			}
-			write_to_all("\n");
-
-			/* RANDOM */
-			write_to_all("\t\tRandom: ");
-			for (unsigned int iSample = 1; iSample <= NUMBER_OF_SAMPLES; ++iSample) {
-				// generate sample file name
-				std::ostringstream oss;
-				oss << "./data/sortings/unique_keys_" << sz << '_' << iSample << "_random.txt";
-				std::string fileName = oss.str();
-				std::cout << "Benchmarking " << fileName << '\n';
-				int *arr = read_data_from_file(fileName, sz);
-				if (arr) {
-					benchmark_and_write_all(arr, sz);
-					std::cout << "Finished benchmarking " << fileName << '\n';
-				}
-				else {
-					std::cout << "Error " << fileName << '\n';
-				}
+		}
+		else if (arg == "--stable") {
+			options.stableOnly = true;
+		}
+		else if (arg == "--in-place") {
+			options.inPlaceOnly = true;
+		}
+		else if (arg == "--no-buffer") {
+			options.noBufferOnly = true;
+		}
+		else if (arg == "--counters") {
+			options.hardwareCounters = true;
+		}
+		else if (arg == "--counts") {
+			options.operationCounts = true;
+		}
+		else if (arg == "--memory") {
+			options.memory = true;
+		}
+		else {
+			std::cout << "Unknown option: " << arg << '\n';
+			return false;
+		}
+	}
+	return true;
+}
+
+void benchmark_sorting_algorithms(int argc, char const *const *argv) {
+	BenchmarkOptions options;
+	if (!parse_benchmark_options(argc, argv, options)) {
+		print_usage(argc > 0 ? argv[0] : "driver");
+		return;
+	}
+	benchmark_sorting_algorithms(options);
+}
+
+void benchmark_sorting_algorithms(BenchmarkOptions const &options) {
+	// warn about names that do not match any registered algorithm
+	for (auto const &name : options.algorithms) {
+		auto const &registry = sort_algorithm_registry();
+		if (std::none_of(registry.begin(), registry.end(), [&name](SortAlgorithm const &a) { return a.name == name; })) {
+			std::cout << "Unknown sorting algorithm: " << name << '\n';
+		}
+	}
+
+	// select the algorithms and open their output files
+	std::vector<SortAlgorithm const *> algorithms;
+	std::vector<std::ofstream> outputs;
+	for (auto const &algorithm : sort_algorithm_registry()) {
+		if (is_selected(options.algorithms, algorithm.name) && has_capabilities(options, algorithm)) {
+			std::ofstream output(algorithm.name + "_sort_benchmark_result.txt");
+			if (!output) {
+				puts("Cannot open output files.");
+				return;
 			}
-			write_to_all("\n");
+			std::cout << "Selected " << algorithm.name << " sort (" << format_capabilities(algorithm) << ")\n";
+			output << "Capabilities: " << format_capabilities(algorithm) << '\n';
+			algorithms.push_back(&algorithm);
+			outputs.push_back(std::move(output));
+		}
+	}
 
+	// select the data shapes
+	std::vector<DataShape const *> shapes;
+	for (auto const &shape : data_shape_registry()) {
+		if (is_selected(options.shapes, shape)) {
+			shapes.push_back(&shape);
+		}
+	}
+
+	if (algorithms.empty() || shapes.empty()) {
+		puts("Nothing to benchmark.");
+		return;
+	}
+
+	// the counters are optional and may be unavailable, e.g. inside a container
+	HardwareCounters hardwareCounters;
+	HardwareCounters *counters = nullptr;
+	if (options.hardwareCounters) {
+		if (hardwareCounters.available()) {
+			counters = &hardwareCounters;
+		}
+		else {
+			puts("Hardware performance counters are unavailable, only timings are reported.");
 		}
 	}
 
-	write_to_all("Normal distribution:\n");
-	/* NORMAL DISTRIBUTION */
-	for (unsigned int iSz = 0, nSz = sizeof(SAMPLE_SIZES) / sizeof(SAMPLE_SIZES[0]); iSz < nSz; ++iSz) {
-		unsigned int const sz = SAMPLE_SIZES[iSz];
-		write_to_all('\t' + std::to_string(sz) + ":\n");
-		{
-			/* SMALL */
-			write_to_all("\t\tSmall: ");
-			for (unsigned int iSample = 1; iSample <= NUMBER_OF_SAMPLES; ++iSample) {
-				// generate sample file name
-				std::ostringstream oss;
-				oss << "./data/sortings/normal_distribution_" << sz << '_' << iSample << "_small.txt";
-				std::string fileName = oss.str();
-				std::cout << "Benchmarking " << fileName << '\n';
-				int *arr = read_data_from_file(fileName, sz);
-				if (arr) {
-					benchmark_and_write_all(arr, sz);
-					std::cout << "Finished benchmarking " << fileName << '\n';
+	puts("Start benchmarking ...\n");
+
+	// lambda to write data to all output files
+	auto write_to_all = [&outputs](std::string const &data) {
+		for (auto &output : outputs) {
+			output << data;
+		}
+	};
+
+	// shapes of the same family are grouped together in the registry order
+	for (auto iFamily = shapes.begin(); iFamily != shapes.end();) {
+		auto const &family = (*iFamily)->family;
+		auto familyEnd = std::find_if(iFamily, shapes.end(), [&family](DataShape const *s) { return s->family != family; });
+
+		write_to_all((*iFamily)->familyLabel + ":\n");
+		for (unsigned int iSz = 0, nSz = sizeof(SAMPLE_SIZES) / sizeof(SAMPLE_SIZES[0]); iSz < nSz; ++iSz) {
+			unsigned int const sz = SAMPLE_SIZES[iSz];
+			if (!is_selected(options.sizes, sz)) {
+				continue;
+			}
+			write_to_all('\t' + std::to_string(sz) + ":\n");
+			for (auto iShape = iFamily; iShape != familyEnd; ++iShape) {
+				DataShape const &shape = **iShape;
+				write_to_all("\t\t" + shape.label + ": ");
+				std::vector<HardwareCounterValues> counterSums(algorithms.size());
+				std::vector<OperationCounts> operationSums(algorithms.size());
+				std::vector<MemorySums> memorySums(algorithms.size());
+				unsigned int nSorted = 0;
+				for (unsigned int iSample = 1; iSample <= NUMBER_OF_SAMPLES; ++iSample) {
+					// generate sample file name
+					std::ostringstream oss;
+					oss << "./data/sortings/" << shape.family << '_' << sz << '_' << iSample << '_' << shape.name << ".txt";
+					std::string fileName = oss.str();
+					std::cout << "Benchmarking " << fileName << '\n';
+					// sort the sample with every algorithm that supports its key type
+					// return false if the sample cannot be read
+					auto benchmark_sample = [&](auto *arr, auto sort_of) {
+						if (!arr) {
+							return false;
+						}
+						for (std::size_t i = 0; i < algorithms.size(); ++i) {
+							auto sort = sort_of(*algorithms[i]);
+							if (!sort) {
+								outputs[i] << "- ";
+								continue;
+							}
+							BenchmarkResult result = benchmark(arr, sz, sort, counters, options.memory);
+							outputs[i] << result.microseconds << ' ';
+							counterSums[i] += result.counters;
+							memorySums[i].add(result);
+							// the counted instantiations are on int keys only
+							if constexpr (std::is_same<std::remove_pointer_t<decltype(arr)>, int>::value) {
+								if (options.operationCounts && algorithms[i]->countedSort) {
+									operationSums[i] += count_operations(arr, sz, algorithms[i]->countedSort);
+								}
+							}
+						}
+						delete[] arr;
+						return true;
+					};
+					bool finished = shape.wideKeys
+						? benchmark_sample(read_data_from_file<long long>(fileName, sz), [](SortAlgorithm const &a) { return a.wideSort; })
+						: benchmark_sample(read_data_from_file<int>(fileName, sz), [](SortAlgorithm const &a) { return a.sort; });
+					if (finished) {
+						++nSorted;
+						std::cout << "Finished benchmarking " << fileName << '\n';
+					}
+					else {
+						std::cout << "Error " << fileName << '\n';
+					}
 				}
-				else {
-					std::cout << "Error " << fileName << '\n';
+				if (counters && nSorted > 0) {
+					for (std::size_t i = 0; i < algorithms.size(); ++i) {
+						outputs[i] << format_counters(counterSums[i], static_cast<double>(sz) * nSorted);
+					}
 				}
-			}
-			write_to_all("\n");
-
-			/* LARGE */
-			write_to_all("\t\tLarge: ");
-			for (unsigned int iSample = 1; iSample <= NUMBER_OF_SAMPLES; ++iSample) {
-				// generate sample file name
-				std::ostringstream oss;
-				oss << "./data/sortings/normal_distribution_" << sz << '_' << iSample << "_large.txt";
-				std::string fileName = oss.str();
-				std::cout << "Benchmarking " << fileName << '\n';
-				int *arr = read_data_from_file(fileName, sz);
-				if (arr) {
-					benchmark_and_write_all(arr, sz);
-					std::cout << "Finished benchmarking " << fileName << '\n';
+				if (options.memory && nSorted > 0) {
+					for (std::size_t i = 0; i < algorithms.size(); ++i) {
+						outputs[i] << format_memory(memorySums[i], nSorted);
+					}
 				}
-				else {
-					std::cout << "Error " << fileName << '\n';
+				if (options.operationCounts && !shape.wideKeys && nSorted > 0) {
+					for (std::size_t i = 0; i < algorithms.size(); ++i) {
+						if (algorithms[i]->countedSort) {
+							outputs[i] << format_operation_counts(operationSums[i], nSorted);
+						}
+					}
 				}
+				write_to_all("\n");
 			}
-			write_to_all("\n");
 		}
-	}
 
-	delete[] arr;
+		iFamily = familyEnd;
+	}
 
-	heapSortOutput.close();
-	mergeSortOutput.close();
-	quickSortOutput.close();
-	shellSortOutput.close();
+	for (auto &output : outputs) {
+		output.close();
+	}
 
 	puts("Finished benchmarking ...\n");
-}
\ No newline at end of file
+}
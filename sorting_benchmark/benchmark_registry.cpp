@@ -0,0 +1,91 @@
+/*
+ *	File name:	"benchmark_registry.cpp"
+ *	Date:		10/18/2026 9:25:03 AM
+ *	Author:		Vo, Dinh Tue Minh
+ *	Purpose:	Implement the registries and register the built-in
+ *				sorting algorithms and data shapes
+ */
+
+#include "./inc/benchmark_registry.hpp"
+#include "../inc/sorts/experimental_heap_sort.hpp"
+#include "../inc/sorts/experimental_merge_sort.hpp"
+#include "../inc/sorts/experimental_quick_sort.hpp"
+#include "../inc/sorts/experimental_shell_sort.hpp"
+
+#include <algorithm>
+
+using namespace experimental;
+
+std::vector<SortAlgorithm>& sort_algorithm_registry() {
+	static std::vector<SortAlgorithm> registry;
+	return registry;
+}
+
+std::vector<DataShape>& data_shape_registry() {
+	static std::vector<DataShape> registry;
+	return registry;
+}
+
+bool register_sort_algorithm(SortAlgorithm const &algorithm) {
+	auto &registry = sort_algorithm_registry();
+	auto found = std::find_if(registry.begin(), registry.end(), [&algorithm](SortAlgorithm const &a) {
+		return a.name == algorithm.name;
+	});
+	if (found != registry.end()) {
+		return false;
+	}
+	registry.push_back(algorithm);
+	return true;
+}
+
+bool register_data_shape(DataShape const &shape) {
+	auto &registry = data_shape_registry();
+	auto found = std::find_if(registry.begin(), registry.end(), [&shape](DataShape const &s) {
+		return s.family == shape.family && s.name == shape.name;
+	});
+	if (found != registry.end()) {
+		return false;
+	}
+	registry.push_back(shape);
+	return true;
+}
+
+namespace {
+	/* Built-in sorting algorithms */
+	// ==========================================================================
+	// registered in one translation unit so that the order of the output is deterministic
+
+	SortAlgorithmRegistrar const heapSortRegistrar{ { "heap", heap_sort<int, std::less<int>>, heap_sort<long long, std::less<long long>>, heap_sort<Counted<int>, std::less<Counted<int>>>, false, true, false } };
+	SortAlgorithmRegistrar const mergeSortRegistrar{ { "merge", merge_sort<int, std::less<int>>, merge_sort<long long, std::less<long long>>, merge_sort<Counted<int>, std::less<Counted<int>>>, true, false, true } };
+	SortAlgorithmRegistrar const quickSortRegistrar{ { "quick", quick_sort<int, std::less<int>>, quick_sort<long long, std::less<long long>>, quick_sort<Counted<int>, std::less<Counted<int>>>, false, true, false } };
+	SortAlgorithmRegistrar const shellSortRegistrar{ { "shell", shell_sort<int, std::less<int>>, shell_sort<long long, std::less<long long>>, shell_sort<Counted<int>, std::less<Counted<int>>>, false, true, false } };
+
+	/* Built-in data shapes */
+	// ==========================================================================
+	// these are the samples written by generate_samples()
+
+	DataShapeRegistrar const smallKeysSorted{ { "small_keys", "Small keys", "sorted", "Sorted" } };
+	DataShapeRegistrar const smallKeysReversedSorted{ { "small_keys", "Small keys", "reversed_sorted", "Reversed sorted" } };
+	DataShapeRegistrar const smallKeysAlmostSorted{ { "small_keys", "Small keys", "almost_sorted", "Almost sorted" } };
+	DataShapeRegistrar const smallKeysRandom{ { "small_keys", "Small keys", "random", "Random" } };
+
+	DataShapeRegistrar const uniqueKeysSorted{ { "unique_keys", "Unique keys", "sorted", "Sorted" } };
+	DataShapeRegistrar const uniqueKeysReversedSorted{ { "unique_keys", "Unique keys", "reversed_sorted", "Reversed sorted" } };
+	DataShapeRegistrar const uniqueKeysAlmostSorted{ { "unique_keys", "Unique keys", "almost_sorted", "Almost sorted" } };
+	DataShapeRegistrar const uniqueKeysRandom{ { "unique_keys", "Unique keys", "random", "Random" } };
+
+	DataShapeRegistrar const normalDistributionSmall{ { "normal_distribution", "Normal distribution", "small", "Small" } };
+	DataShapeRegistrar const normalDistributionLarge{ { "normal_distribution", "Normal distribution", "large", "Large" } };
+
+	DataShapeRegistrar const zipfKeysLowSkew{ { "zipf_keys", "Zipf keys", "low_skew", "Low skew" } };
+	DataShapeRegistrar const zipfKeysHighSkew{ { "zipf_keys", "Zipf keys", "high_skew", "High skew" } };
+
+	DataShapeRegistrar const patternsOrganPipe{ { "patterns", "Patterns", "organ_pipe", "Organ pipe" } };
+	DataShapeRegistrar const patternsSawtooth{ { "patterns", "Patterns", "sawtooth", "Sawtooth" } };
+	DataShapeRegistrar const patternsKRuns{ { "patterns", "Patterns", "k_runs", "K runs" } };
+	DataShapeRegistrar const patternsMedianOf3Killer{ { "patterns", "Patterns", "median_of_3_killer", "Median-of-3 killer" } };
+	DataShapeRegistrar const patternsAllEqual{ { "patterns", "Patterns", "all_equal", "All equal" } };
+	DataShapeRegistrar const patternsFewSwapsAtEnd{ { "patterns", "Patterns", "few_swaps_at_end", "Few swaps at end" } };
+
+	DataShapeRegistrar const keys64BitRandom{ { "keys_64bit", "64-bit keys", "random", "Random", true } };
+}
@@ -0,0 +1,145 @@
+/*
+ *	File name:	"hardware_counters.cpp"
+ *	Date:		10/18/2026 11:20:44 AM
+ *	Author:		Vo, Dinh Tue Minh
+ *	Purpose:	Implement hardware performance counters
+ */
+
+#include "./inc/hardware_counters.hpp"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <cstdint>
+#include <cstring>
+
+char const *const HARDWARE_EVENT_NAMES[HARDWARE_EVENT_COUNT] = {
+	"cycles", "instructions", "branch-misses", "L1d-misses", "LLC-misses", "dTLB-misses"
+};
+
+double HardwareCounterValues::ipc() const {
+	if (!valid[CPU_CYCLES] || !valid[INSTRUCTIONS] || values[CPU_CYCLES] == 0) {
+		return 0.0;
+	}
+	return static_cast<double>(values[INSTRUCTIONS]) / values[CPU_CYCLES];
+}
+
+HardwareCounterValues& HardwareCounterValues::operator+=(HardwareCounterValues const &rhs) {
+	for (int i = 0; i < HARDWARE_EVENT_COUNT; ++i) {
+		if (rhs.valid[i]) {
+			values[i] += rhs.values[i];
+			valid[i] = true;
+		}
+	}
+	return *this;
+}
+
+#ifdef __linux__
+
+namespace {
+	// encode a generalized cache event
+	constexpr std::uint64_t cache_event(std::uint64_t cache) {
+		return cache
+			| (static_cast<std::uint64_t>(PERF_COUNT_HW_CACHE_OP_READ) << 8)
+			| (static_cast<std::uint64_t>(PERF_COUNT_HW_CACHE_RESULT_MISS) << 16);
+	}
+
+	// open a disabled user-space counter for the calling thread on any CPU
+	// return -1 if the event is not supported or not permitted
+	int open_counter(std::uint32_t type, std::uint64_t config) {
+		perf_event_attr attr;
+		std::memset(&attr, 0, sizeof(attr));
+		attr.size = sizeof(attr);
+		attr.type = type;
+		attr.config = config;
+		attr.disabled = 1;
+		attr.exclude_kernel = 1;
+		attr.exclude_hv = 1;
+		attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+		return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+	}
+}
+
+HardwareCounters::HardwareCounters() {
+	fds_[CPU_CYCLES] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+	fds_[INSTRUCTIONS] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+	fds_[BRANCH_MISSES] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+	fds_[L1D_READ_MISSES] = open_counter(PERF_TYPE_HW_CACHE, cache_event(PERF_COUNT_HW_CACHE_L1D));
+	fds_[LLC_READ_MISSES] = open_counter(PERF_TYPE_HW_CACHE, cache_event(PERF_COUNT_HW_CACHE_LL));
+	fds_[DTLB_READ_MISSES] = open_counter(PERF_TYPE_HW_CACHE, cache_event(PERF_COUNT_HW_CACHE_DTLB));
+}
+
+HardwareCounters::~HardwareCounters() {
+	for (int fd : fds_) {
+		if (fd >= 0) {
+			close(fd);
+		}
+	}
+}
+
+bool HardwareCounters::available() const noexcept {
+	for (int fd : fds_) {
+		if (fd >= 0) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void HardwareCounters::start() {
+	for (int fd : fds_) {
+		if (fd >= 0) {
+			ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+			ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+		}
+	}
+}
+
+HardwareCounterValues HardwareCounters::stop() {
+	for (int fd : fds_) {
+		if (fd >= 0) {
+			ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+		}
+	}
+
+	HardwareCounterValues result;
+	for (int i = 0; i < HARDWARE_EVENT_COUNT; ++i) {
+		// value, time enabled, time running
+		std::uint64_t data[3];
+		if (fds_[i] < 0 || read(fds_[i], data, sizeof(data)) != static_cast<ssize_t>(sizeof(data)) || data[2] == 0) {
+			continue;
+		}
+		// scale the value if the counter was multiplexed
+		result.values[i] = data[1] == data[2]
+			? static_cast<long long>(data[0])
+			: static_cast<long long>(static_cast<double>(data[0]) * data[1] / data[2]);
+		result.valid[i] = true;
+	}
+	return result;
+}
+
+#else
+
+HardwareCounters::HardwareCounters() {
+	for (int &fd : fds_) {
+		fd = -1;
+	}
+}
+
+HardwareCounters::~HardwareCounters() {}
+
+bool HardwareCounters::available() const noexcept {
+	return false;
+}
+
+void HardwareCounters::start() {}
+
+HardwareCounterValues HardwareCounters::stop() {
+	return {};
+}
+
+#endif
@@ -0,0 +1,54 @@
+/*
+ *	File name:	"allocation_tracker.hpp"
+ *	Date:		10/18/2026 3:05:51 PM
+ *	Author:		Vo, Dinh Tue Minh
+ *	Purpose:	Track the heap allocations and the resident set size
+ *				of the benchmarked sorting calls.
+ *				The tracking replaces the global operator new/delete
+ *				of the whole program, but only counts while it is enabled.
+ */
+
+#pragma once
+
+#ifndef _ALLOCATION_TRACKER_HPP_
+#define _ALLOCATION_TRACKER_HPP_
+
+/*	Snapshot of the allocations done through the global operator new
+ *	while the tracking is enabled
+ *
+ *	allocations: number of calls to operator new
+ *	deallocations: number of calls to operator delete
+ *	currentBytes: bytes that are allocated now
+ *	peakBytes: maximum of currentBytes since the last reset_allocation_peak()
+ */
+struct AllocationStats {
+	long long allocations;
+	long long deallocations;
+	long long currentBytes;
+	long long peakBytes;
+};
+
+// start or stop counting the allocations
+// the counters cost a few atomic operations per allocation, so enable them only around a measurement
+void set_allocation_tracking(bool enabled) noexcept;
+
+// get the current snapshot
+AllocationStats allocation_stats() noexcept;
+
+// set the peak to the bytes that are allocated now
+// so that the next peak measures a single call
+void reset_allocation_peak() noexcept;
+
+// get the resident set size of the process in bytes
+// return -1 if unavailable
+long long current_rss_bytes();
+
+// reset the peak resident set size of the process to the current one
+// return false if the peak cannot be reset
+bool reset_peak_rss();
+
+// get the peak resident set size of the process in bytes
+// return -1 if unavailable
+long long peak_rss_bytes();
+
+#endif // !_ALLOCATION_TRACKER_HPP_
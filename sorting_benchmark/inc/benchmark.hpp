@@ -10,6 +10,52 @@
 #ifndef _BENCHMARK_HPP_
 #define _BENCHMARK_HPP_
 
-void benchmark_sorting_algorithms();
+#include <string>
+#include <utility>
+#include <vector>
+
+/*	Filters of the benchmark
+ *	An empty filter selects everything.
+ *
+ *	algorithms: names of the registered sorting algorithms, e.g. "quick"
+ *	shapes: data shapes given as "<name>", "<family>" or "<family>/<name>", e.g. "random"
+ *	sizes: inclusive ranges of the input sizes
+ *	hardwareCounters: also report IPC and misses per element
+ *	operationCounts: also report comparisons, copies, moves and swaps per sorting call
+ *	memory: also report the peak extra bytes, the allocations and the RSS growth per sorting call
+ */
+struct BenchmarkOptions {
+	std::vector<std::string> algorithms;
+	std::vector<std::string> shapes;
+	std::vector<std::pair<double, double>> sizes;
+	bool stableOnly = false;		// only the algorithms registered as stable
+	bool inPlaceOnly = false;		// only the algorithms registered as in-place
+	bool noBufferOnly = false;		// only the algorithms that do not allocate an n-element buffer
+	bool hardwareCounters = false;
+	bool operationCounts = false;
+	bool memory = false;
+};
+
+/*	Parse the command-line filters
+ *		--algo=quick,merge
+ *		--size=1e6..1e8,1000
+ *		--shape=random,unique_keys/sorted
+ *		--stable
+ *		--in-place
+ *		--no-buffer
+ *		--counters
+ *		--counts
+ *		--memory
+ *
+ *	Return: false if an argument cannot be parsed
+ */
+bool parse_benchmark_options(int argc, char const *const *argv, BenchmarkOptions &options);
+
+// benchmark the registered sorting algorithms that pass the filters
+void benchmark_sorting_algorithms(BenchmarkOptions const &options = BenchmarkOptions{});
+
+// parse the command-line filters then run the benchmark
+// print the usage if the arguments are invalid
+void benchmark_sorting_algorithms(int argc, char const *const *argv);
 
 #endif // !_BENCHMARK_HPP_
@@ -0,0 +1,96 @@
+/*
+ *	File name:	"benchmark_registry.hpp"
+ *	Date:		10/18/2026 9:12:40 AM
+ *	Author:		Vo, Dinh Tue Minh
+ *	Purpose:	Registries of the sorting algorithms and the data shapes
+ *				that can be benchmarked
+ */
+
+#pragma once
+
+#ifndef _BENCHMARK_REGISTRY_HPP_
+#define _BENCHMARK_REGISTRY_HPP_
+
+#include "../../inc/experimental_alias_declarations.hpp"
+#include "../../inc/experimental_operation_counters.hpp"
+
+#include <functional>
+#include <string>
+#include <vector>
+
+// signature of a sorting function that can be benchmarked
+using sort_function = void (*)(int *, experimental::alias::size_type, std::less<int>);
+
+// signature of the same sorting function on 64-bit keys
+using wide_sort_function = void (*)(long long *, experimental::alias::size_type, std::less<long long>);
+
+// signature of the same sorting function on counted elements
+using counted_sort_function = void (*)(experimental::Counted<int> *, experimental::alias::size_type, std::less<experimental::Counted<int>>);
+
+/*	A sorting algorithm and its capabilities
+ *
+ *	name: short name used to select the algorithm, e.g. "quick"
+ *	sort: the sorting function
+ *	wideSort: the same function instantiated on long long, may be null
+ *	countedSort: the same function instantiated on Counted<int>, may be null
+ *	stable: equal keys keep their relative order
+ *	inPlace: sorts with at most O(log n) extra memory
+ *	needsBuffer: allocates an n-element buffer
+ */
+struct SortAlgorithm {
+	std::string name;
+	sort_function sort;
+	wide_sort_function wideSort;
+	counted_sort_function countedSort;
+	bool stable;
+	bool inPlace;
+	bool needsBuffer;
+};
+
+/*	A shape of the benchmark inputs
+ *	Sample files are named "<family>_<size>_<sample>_<name>.txt"
+ *
+ *	family: key family, e.g. "small_keys"
+ *	familyLabel: printable name of the family, e.g. "Small keys"
+ *	name: shape inside the family, e.g. "random"
+ *	label: printable name of the shape, e.g. "Random"
+ *	wideKeys: the keys are 64-bit integers
+ */
+struct DataShape {
+	std::string family;
+	std::string familyLabel;
+	std::string name;
+	std::string label;
+	bool wideKeys = false;
+};
+
+// all registered sorting algorithms in registration order
+std::vector<SortAlgorithm>& sort_algorithm_registry();
+
+// all registered data shapes in registration order
+std::vector<DataShape>& data_shape_registry();
+
+// add an algorithm to the registry
+// return false if an algorithm with the same name has been registered
+bool register_sort_algorithm(SortAlgorithm const &algorithm);
+
+// add a data shape to the registry
+// return false if the shape has been registered
+bool register_data_shape(DataShape const &shape);
+
+/*	Register an object at static initialization time
+ *	Usage: static SortAlgorithmRegistrar const r{ { "quick", quick_sort, quick_sort, quick_sort, false, true, false } };
+ */
+struct SortAlgorithmRegistrar {
+	explicit SortAlgorithmRegistrar(SortAlgorithm const &algorithm) {
+		register_sort_algorithm(algorithm);
+	}
+};
+
+struct DataShapeRegistrar {
+	explicit DataShapeRegistrar(DataShape const &shape) {
+		register_data_shape(shape);
+	}
+};
+
+#endif // !_BENCHMARK_REGISTRY_HPP_
@@ -0,0 +1,70 @@
+/*
+ *	File name:	"hardware_counters.hpp"
+ *	Date:		10/18/2026 11:02:17 AM
+ *	Author:		Vo, Dinh Tue Minh
+ *	Purpose:	Hardware performance counters around a benchmarked call.
+ *				Implemented with perf_event_open on Linux,
+ *				unavailable on other platforms.
+ */
+
+#pragma once
+
+#ifndef _HARDWARE_COUNTERS_HPP_
+#define _HARDWARE_COUNTERS_HPP_
+
+// events that are counted
+enum HardwareEvent {
+	CPU_CYCLES = 0,
+	INSTRUCTIONS,
+	BRANCH_MISSES,
+	L1D_READ_MISSES,
+	LLC_READ_MISSES,
+	DTLB_READ_MISSES,
+	HARDWARE_EVENT_COUNT
+};
+
+// printable names of the events
+extern char const *const HARDWARE_EVENT_NAMES[HARDWARE_EVENT_COUNT];
+
+/*	Values of the counters of one measurement
+ *	A counter that cannot be opened or read is marked invalid.
+ *	Values are scaled if the kernel multiplexed the counters.
+ */
+struct HardwareCounterValues {
+	long long values[HARDWARE_EVENT_COUNT] = {};
+	bool valid[HARDWARE_EVENT_COUNT] = {};
+
+	// instructions per cycle, 0 if unknown
+	double ipc() const;
+
+	// add the valid values of 'rhs'
+	HardwareCounterValues& operator+=(HardwareCounterValues const &rhs);
+};
+
+/*	HardwareCounters class
+	opens one counter per event for the calling thread, user space only.
+	If the kernel does not allow the counters, e.g. inside a container,
+	available() is false and start()/stop() do nothing.
+*/
+class HardwareCounters {
+public:
+	HardwareCounters();
+	~HardwareCounters();
+
+	HardwareCounters(HardwareCounters const &) = delete;
+	HardwareCounters& operator=(HardwareCounters const &) = delete;
+
+	// query if at least one counter is opened
+	bool available() const noexcept;
+
+	// reset and enable the counters
+	void start();
+
+	// disable the counters and read their values
+	HardwareCounterValues stop();
+
+private:
+	int fds_[HARDWARE_EVENT_COUNT];
+};
+
+#endif // !_HARDWARE_COUNTERS_HPP_
@@ -44,6 +44,92 @@ int* generate_random_numbers_in_range(unsigned int sz, unsigned int low, unsigne
  */
 int* generate_random_numbers_with_normal_distribution(unsigned int sz, double mean, double sd);
 
+/*	Generate random integer numbers based on Zipf's law:
+ *	the key of rank k appears with a probability proportional to 1/k^skew
+ *
+ *	sz: total random numbers
+ *	nKeys: number of distinct keys, the keys are in range [1, nKeys]
+ *	skew: exponent of the distribution, must be positive
+ *	Return: pointer to array
+ *
+ *	Note: caller should free the array.
+ */
+int* generate_zipf_numbers(unsigned int sz, unsigned int nKeys, double skew);
+
+/*	Generate an organ pipe: ascending to the middle then descending
+ *	e.g. 0 1 2 3 3 2 1 0
+ *
+ *	sz: total numbers
+ *	Return: pointer to array
+ *
+ *	Note: caller should free the array.
+ */
+int* generate_organ_pipe_numbers(unsigned int sz);
+
+/*	Generate a sawtooth: ascending runs of 'period' numbers
+ *	e.g. 0 1 2 0 1 2 0 1
+ *
+ *	sz: total numbers
+ *	period: length of a tooth
+ *	Return: pointer to array
+ *
+ *	Note: caller should free the array.
+ */
+int* generate_sawtooth_numbers(unsigned int sz, unsigned int period);
+
+/*	Generate 'k' sorted runs of random lengths
+ *	The keys of each run are random in range [0, sz]
+ *
+ *	sz: total numbers
+ *	k: number of runs
+ *	Return: pointer to array
+ *
+ *	Note: caller should free the array.
+ */
+int* generate_k_runs_numbers(unsigned int sz, unsigned int k);
+
+/*	Generate a median-of-3 killer sequence for experimental::quick_sort,
+ *	built by replaying its median3() and partition steps so that every pivot is the second smallest key
+ *	of its subarray, which makes the sort degrade to quadratic time
+ *
+ *	sz: total numbers
+ *	Return: pointer to array
+ *
+ *	Note: caller should free the array.
+ */
+int* generate_median_of_3_killer_numbers(unsigned int sz);
+
+/*	Generate numbers that are all equal to 'key'
+ *
+ *	sz: total numbers
+ *	key: the only key
+ *	Return: pointer to array
+ *
+ *	Note: caller should free the array.
+ */
+int* generate_all_equal_numbers(unsigned int sz, int key);
+
+/*	Generate sorted numbers then swap the last 'nSwaps' numbers
+ *	with numbers at random positions
+ *
+ *	sz: total numbers
+ *	nSwaps: number of swaps
+ *	Return: pointer to array
+ *
+ *	Note: caller should free the array.
+ */
+int* generate_few_swaps_at_end_numbers(unsigned int sz, unsigned int nSwaps);
+
+/*	Generate random 64-bit integer numbers
+ *	based on uniform distribution over the whole range of long long
+ *
+ *	sz: total random numbers
+ *	Return: pointer to array
+ *
+ *	Note: caller should free the array.
+ */
+long long* generate_random_64bit_numbers(unsigned int sz);
+
 void generate_samples();
 
 #endif // !_RANDOM_GENERATOR_HPP_
@@ -6,6 +6,7 @@
  */
 
 #include "./inc/random_generator.hpp"
+#include "../inc/sorts/experimental_quick_sort.hpp"
 
 #include <vector>
 #include <random>
@@ -13,6 +14,9 @@
 #include <string>
 #include <sstream>
 #include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <limits>
 
 unsigned int generate_random_number_in_range(unsigned int low, unsigned int high) {
 	static std::random_device rd;
@@ -47,11 +51,225 @@ int* generate_random_numbers_with_normal_distribution(unsigned int sz, double me
 	return arr;
 }
 
+namespace {
+	/*	Zipf distribution over [1, n] with exponent 'skew'
+	 *	sampled by rejection-inversion (Hormann and Derflinger)
+	 *	so that no table of n probabilities is needed
+	 */
+	class ZipfDistribution {
+	public:
+		ZipfDistribution(unsigned int n, double skew)
+			: n_{ n }, skew_{ skew },
+			  hIntegralX1_{ h_integral(1.5) - 1.0 },
+			  hIntegralN_{ h_integral(n + 0.5) },
+			  s_{ 2.0 - h_integral_inverse(h_integral(2.5) - h(2.0)) } {}
+
+		template<typename Generator>
+		unsigned int operator()(Generator &gen) {
+			std::uniform_real_distribution<> d(0.0, 1.0);
+			while (true) {
+				double u = hIntegralN_ + d(gen) * (hIntegralX1_ - hIntegralN_);
+				double x = h_integral_inverse(u);
+				double k = std::floor(x + 0.5);
+				if (k < 1.0) {
+					k = 1.0;
+				}
+				else if (k > n_) {
+					k = n_;
+				}
+				if (k - x <= s_ || u >= h_integral(k + 0.5) - h(k)) {
+					return static_cast<unsigned int>(k);
+				}
+			}
+		}
+
+	private:
+		unsigned int n_;
+		double skew_;
+		double hIntegralX1_;
+		double hIntegralN_;
+		double s_;
+
+		// log(1 + x) / x, accurate near 0
+		static double helper1(double x) {
+			return std::abs(x) > 1e-8 ? std::log1p(x) / x : 1.0 - x * (0.5 - x * (1.0 / 3.0 - 0.25 * x));
+		}
+
+		// (exp(x) - 1) / x, accurate near 0
+		static double helper2(double x) {
+			return std::abs(x) > 1e-8 ? std::expm1(x) / x : 1.0 + x * 0.5 * (1.0 + x / 3.0 * (1.0 + 0.25 * x));
+		}
+
+		double h(double x) const {
+			return std::exp(-skew_ * std::log(x));
+		}
+
+		double h_integral(double x) const {
+			double logX = std::log(x);
+			return helper2((1.0 - skew_) * logX) * logX;
+		}
+
+		double h_integral_inverse(double x) const {
+			double t = x * (1.0 - skew_);
+			if (t < -1.0) {
+				t = -1.0;
+			}
+			return std::exp(helper1(t) * x);
+		}
+	};
+}
+
+int* generate_zipf_numbers(unsigned int sz, unsigned int nKeys, double skew) {
+	static std::random_device rd;
+	static std::mt19937 gen(rd());
+	ZipfDistribution d(nKeys, skew);
+
+	int *arr = new int[sz];
+	for (unsigned int i = 0; i < sz; ++i) {
+		arr[i] = static_cast<int>(d(gen));
+	}
+
+	return arr;
+}
+
+int* generate_organ_pipe_numbers(unsigned int sz) {
+	int *arr = new int[sz];
+	for (unsigned int i = 0, half = sz / 2; i < sz; ++i) {
+		arr[i] = static_cast<int>(i < half ? i : sz - 1 - i);
+	}
+
+	return arr;
+}
+
+int* generate_sawtooth_numbers(unsigned int sz, unsigned int period) {
+	int *arr = new int[sz];
+	for (unsigned int i = 0; i < sz; ++i) {
+		arr[i] = static_cast<int>(i % period);
+	}
+
+	return arr;
+}
+
+int* generate_k_runs_numbers(unsigned int sz, unsigned int k) {
+	int *arr = generate_random_numbers_in_range(sz, 0, sz);
+	if (sz == 0 || k == 0) {
+		return arr;
+	}
+
+	// pick k - 1 distinct cut points, so the runs have random lengths
+	std::vector<unsigned int> cuts{ 0, sz };
+	for (unsigned int i = 1; i < k && i < sz; ++i) {
+		unsigned int cut;
+		do {
+			cut = generate_random_number_in_range(1, sz - 1);
+		}
+		while (std::find(cuts.begin(), cuts.end(), cut) != cuts.end());
+		cuts.push_back(cut);
+	}
+	std::sort(cuts.begin(), cuts.end());
+
+	for (std::size_t i = 1; i < cuts.size(); ++i) {
+		std::sort(arr + cuts[i - 1], arr + cuts[i]);
+	}
+
+	return arr;
+}
+
+int* generate_median_of_3_killer_numbers(unsigned int sz) {
+	/*	Built against experimental::quick_sort by replaying its partitions:
+	 *	in the subarray [left, right], the elements that median3() takes from
+	 *	'left' and 'center' get the two smallest keys that are left.
+	 *	The pivot is then the second smallest key, so each partition only
+	 *	removes two elements and the sort does about sz^2/4 comparisons.
+	 */
+	int *arr = new int[sz];
+	std::vector<unsigned int> at(sz); // original index of the element at each position
+	for (unsigned int i = 0; i < sz; ++i) {
+		at[i] = i;
+		arr[i] = -1;
+	}
+
+	using experimental::alias::size_type;
+	int key = 0;
+	if (sz > 0) {
+		for (size_type left = 0, right = sz - 1; left + experimental::details::THRESHOLD < right; left += 2) {
+			size_type center = left + (right - left) / 2;
+			arr[at[left]] = key++;
+			arr[at[center]] = key++;
+			// median3() moves the pivot to 'right - 1' and the partition moves it to 'left + 1'
+			std::swap(at[center], at[right - 1]);
+			std::swap(at[left + 1], at[right - 1]);
+		}
+	}
+	// the rest goes to insertion sort, its order does not matter
+	for (unsigned int i = 0; i < sz; ++i) {
+		if (arr[i] < 0) {
+			arr[i] = key++;
+		}
+	}
+
+	return arr;
+}
+
+int* generate_all_equal_numbers(unsigned int sz, int key) {
+	int *arr = new int[sz];
+	std::fill(arr, arr + sz, key);
+
+	return arr;
+}
+
+int* generate_few_swaps_at_end_numbers(unsigned int sz, unsigned int nSwaps) {
+	int *arr = new int[sz];
+	for (unsigned int i = 0; i < sz; ++i) {
+		arr[i] = static_cast<int>(i);
+	}
+	for (unsigned int i = sz; i > 0 && sz - i < nSwaps; --i) {
+		std::swap(arr[i - 1], arr[generate_random_number_in_range(0, sz - 1)]);
+	}
+
+	return arr;
+}
+
+long long* generate_random_64bit_numbers(unsigned int sz) {
+	static std::random_device rd;
+	static std::mt19937_64 gen(rd());
+	std::uniform_int_distribution<long long> d(std::numeric_limits<long long>::min(), std::numeric_limits<long long>::max());
+
+	long long *arr = new long long[sz];
+	for (unsigned int i = 0; i < sz; ++i) {
+		arr[i] = d(gen);
+	}
+
+	return arr;
+}
+
 unsigned int const SAMPLE_SIZES[6] = { 1'000, 10'000, 100'000, 1'000'000, 10'000'000, 100'000'000 };
 unsigned int const NUMBER_OF_SAMPLES = 5;
 
 static constexpr char const* root = "data/sortings/";
 
+// parameters of the adversarial and real-world samples
+static constexpr double ZIPF_LOW_SKEW = 0.5;
+static constexpr double ZIPF_HIGH_SKEW = 1.2;
+static constexpr unsigned int SAWTOOTH_TEETH = 100;
+static constexpr unsigned int NUMBER_OF_RUNS = 16;
+static constexpr unsigned int KILLER_MAX_SIZE = 100'000; // quick sort is quadratic on the killer
+
+// write a sample to "<root><family>_<sz>_<iSample>_<name>.txt"
+template<typename T>
+static void write_sample(char const *family, char const *name, unsigned int sz, unsigned int iSample, T const *arr) {
+	std::ostringstream oss;
+	oss << root << family << '_' << sz << '_' << iSample << '_' << name << ".txt";
+	std::ofstream output(oss.str());
+	if (output) {
+		output << sz << '\n';
+		for (unsigned int i = 0; i < sz; ++i) {
+			output << arr[i] << ' ';
+		}
+	}
+	output.close();
+}
+
 void generate_samples() {
 	puts("Generating sample...");
 	
@@ -222,6 +440,7 @@ void generate_samples() {
 			{
 				// small normal distribution: mean = sz/2, sd = sz / 100
 				{
+					delete[] arr;
 					arr = generate_random_numbers_with_normal_distribution(sz, sz / 2.0, sz / 100.0);
 					std::ostringstream oss;
 					oss << root << "normal_distribution_" << sz << '_' << iSample << "_small.txt";
@@ -237,6 +456,7 @@ void generate_samples() {
 				}
 				// large normal distribution: mean = sz/2, sd = sz / 10
 				{
+					delete[] arr;
 					arr = generate_random_numbers_with_normal_distribution(sz, sz / 2.0, sz / 10.0);
 					std::ostringstream oss;
 					oss << root << "normal_distribution_" << sz << '_' << iSample << "_large.txt";
@@ -253,6 +473,53 @@ void generate_samples() {
 
 			}
 			delete[] arr;
+			arr = nullptr;
+			{
+				// Zipf distribution: few keys are very frequent, sz keys in total
+				arr = generate_zipf_numbers(sz, sz, ZIPF_LOW_SKEW);
+				write_sample("zipf_keys", "low_skew", sz, iSample, arr);
+				delete[] arr;
+
+				arr = generate_zipf_numbers(sz, sz, ZIPF_HIGH_SKEW);
+				write_sample("zipf_keys", "high_skew", sz, iSample, arr);
+				delete[] arr;
+			}
+			{
+				// patterns that break pivoting or favor adaptive sorts
+				arr = generate_organ_pipe_numbers(sz);
+				write_sample("patterns", "organ_pipe", sz, iSample, arr);
+				delete[] arr;
+
+				arr = generate_sawtooth_numbers(sz, std::max(sz / SAWTOOTH_TEETH, 1u));
+				write_sample("patterns", "sawtooth", sz, iSample, arr);
+				delete[] arr;
+
+				arr = generate_k_runs_numbers(sz, NUMBER_OF_RUNS);
+				write_sample("patterns", "k_runs", sz, iSample, arr);
+				delete[] arr;
+
+				if (sz <= KILLER_MAX_SIZE) {
+					arr = generate_median_of_3_killer_numbers(sz);
+					write_sample("patterns", "median_of_3_killer", sz, iSample, arr);
+					delete[] arr;
+				}
+
+				arr = generate_all_equal_numbers(sz, 0);
+				write_sample("patterns", "all_equal", sz, iSample, arr);
+				delete[] arr;
+
+				// about 0.1% of the numbers are out of place
+				arr = generate_few_swaps_at_end_numbers(sz, sz / 1000 + 1);
+				write_sample("patterns", "few_swaps_at_end", sz, iSample, arr);
+				delete[] arr;
+				arr = nullptr;
+			}
+			{
+				// 64-bit keys
+				long long *arr64 = generate_random_64bit_numbers(sz);
+				write_sample("keys_64bit", "random", sz, iSample, arr64);
+				delete[] arr64;
+			}
 		}
 	}
 	puts("Finished generating samples...");
@@ -0,0 +1,131 @@
+/*
+ *	File name:	"experimental_concurrent_skip_list_unit_test.cpp"
+ *	Date:		10/19/2026 3:48:22 PM
+ *	Author:		Vo, Dinh Tue Minh
+ *	Purpose:	Unit tests for the concurrent skip list
+ */
+
+#include "./inc/unit_test.hpp"
+#include "../inc/ds/experimental_concurrent_skip_list.hpp"
+
+#include <atomic>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace experimental;
+
+bool experimental_concurrent_skip_list_set_test() {
+	ConcurrentSkipList<int> s;
+	if (!s.empty() || s.contains(0) || s.remove(0)) {
+		return false;
+	}
+	constexpr int SZ = 1000;
+	for (int i = 0; i < SZ; ++i) {
+		// insert in a scattered order
+		if (!s.insert((i * 7919) % SZ)) {
+			return false;
+		}
+	}
+	if (s.insert(500) || !s.remove(500) || s.remove(500) || s.contains(500) || !s.insert(500)) {
+		return false;
+	}
+	for (int i = 0; i < SZ; i += 2) {
+		s.remove(i);
+	}
+	int expected = 1;
+	bool inOrder = true;
+	s.for_each([&](int value) {
+		inOrder = inOrder && value == expected;
+		expected += 2;
+	});
+	return inOrder && expected == SZ + 1 && s.contains(999) && !s.contains(998);
+}
+
+bool experimental_concurrent_skip_list_range_test() {
+	ConcurrentSkipList<std::string, std::greater<std::string>> s;
+	for (char c = 'a'; c <= 'z'; ++c) {
+		s.insert(std::string(20, c));
+	}
+	// descending order: ['x...', 'p...') is x down to q
+	std::string visited;
+	s.for_each(std::string(20, 'x'), std::string(20, 'p'), [&visited](std::string const &value) {
+		visited += value[0];
+	});
+	std::string none;
+	s.for_each(std::string(3, 'b'), std::string(20, 'a'), [&none](std::string const &value) {
+		none += value[0];
+	});
+	return visited == "xwvutsrq" && none.empty();
+}
+
+// writers insert and remove keys of a small range against each other while readers search
+// and traverse; every key's successful insertions and removals must balance with the final set
+bool experimental_concurrent_skip_list_threads_test() {
+	constexpr int WRITERS = 6;
+	constexpr int READERS = 2;
+	constexpr int KEYS = 256;
+	constexpr int OPERATIONS = 20000;
+	ConcurrentSkipList<int> s;
+	std::vector<std::atomic<int>> balance(KEYS);
+	std::atomic<bool> inOrder{ true };
+	std::atomic<int> writersDone{ 0 };
+	std::vector<std::thread> threads;
+	for (int w = 0; w < WRITERS; ++w) {
+		threads.emplace_back([&, w]() {
+			unsigned seed = w * 2654435761u + 1;
+			for (int i = 0; i < OPERATIONS; ++i) {
+				seed = seed * 1103515245u + 12345u;
+				int key = (seed >> 8) % KEYS;
+				if ((seed >> 4) & 1) {
+					if (s.insert(key)) {
+						balance[key].fetch_add(1);
+					}
+				}
+				else if (s.remove(key)) {
+					balance[key].fetch_sub(1);
+				}
+			}
+			writersDone.fetch_add(1);
+		});
+	}
+	for (int r = 0; r < READERS; ++r) {
+		threads.emplace_back([&]() {
+			while (writersDone.load() < WRITERS) {
+				int last = -1;
+				s.for_each([&](int value) {
+					if (value <= last) {
+						inOrder = false;
+					}
+					last = value;
+				});
+				s.contains(last);
+			}
+		});
+	}
+	for (auto &t : threads) {
+		t.join();
+	}
+	for (int key = 0; key < KEYS; ++key) {
+		if (balance[key].load() != (s.contains(key) ? 1 : 0)) {
+			return false;
+		}
+	}
+	return inOrder;
+}
+
+void experimental_concurrent_skip_list_unit_tests() {
+	puts("----------------------------------------------------------");
+	puts("Running ConcurrentSkipList Unit Tests...\n");
+
+	_RUN_UNIT_TEST_(experimental_concurrent_skip_list_set_test);
+
+	_RUN_UNIT_TEST_(experimental_concurrent_skip_list_range_test);
+
+	_RUN_UNIT_TEST_(experimental_concurrent_skip_list_threads_test);
+
+	puts("\nFinished ConcurrentSkipList Unit Tests...");
+	puts("----------------------------------------------------------");
+}
@@ -0,0 +1,89 @@
+/*
+ *	File name:	"experimental_concurrent_stack_unit_test.cpp"
+ *	Date:		10/19/2026 11:28:46 AM
+ *	Author:		Vo, Dinh Tue Minh
+ *	Purpose:	Unit tests for lock-free stack
+ */
+
+#include "./inc/unit_test.hpp"
+#include "../inc/ds/experimental_concurrent_stack.hpp"
+
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace experimental;
+
+bool experimental_concurrent_stack_lifo_test() {
+	ConcurrentStack<std::string> stack;
+	std::string s;
+	if (!stack.empty() || stack.try_pop(s)) {
+		return false;
+	}
+	for (int i = 0; i < 100; ++i) {
+		stack.push(std::to_string(i) + " is too long for the small string buffer");
+	}
+	stack.emplace(3, 'x');
+	if (stack.pop() != "xxx") {
+		return false;
+	}
+	for (int i = 99; i >= 50; --i) {
+		if (!stack.try_pop(s) || s.compare(0, std::to_string(i).size() + 1, std::to_string(i) + " ") != 0) {
+			return false;
+		}
+	}
+	// the elements left are destroyed with the stack
+	return !stack.empty();
+}
+
+bool experimental_concurrent_stack_threads_test() {
+	constexpr int THREADS = 8;
+	constexpr int ITEMS_PER_THREAD = 20000;
+	ConcurrentStack<int> stack;
+	std::vector<std::vector<int>> popped(THREADS);
+	std::vector<std::thread> threads;
+	// push and pop in turn as a shared free list, so that pushes and pops collide
+	for (int t = 0; t < THREADS; ++t) {
+		threads.emplace_back([&stack, &popped, t]() {
+			int item;
+			for (int i = 0; i < ITEMS_PER_THREAD; ++i) {
+				stack.push(t * ITEMS_PER_THREAD + i);
+				if (i % 3 != 0 && stack.try_pop(item)) {
+					popped[t].push_back(item);
+				}
+			}
+		});
+	}
+	for (auto &t : threads) {
+		t.join();
+	}
+	std::vector<int> seen(THREADS * ITEMS_PER_THREAD, 0);
+	int item;
+	while (stack.try_pop(item)) {
+		++seen[item];
+	}
+	for (auto const &items : popped) {
+		for (int i : items) {
+			++seen[i];
+		}
+	}
+	for (int count : seen) {
+		if (count != 1) {
+			return false;
+		}
+	}
+	return stack.empty();
+}
+
+void experimental_concurrent_stack_unit_tests() {
+	puts("----------------------------------------------------------");
+	puts("Running ConcurrentStack Unit Tests...\n");
+
+	_RUN_UNIT_TEST_(experimental_concurrent_stack_lifo_test);
+
+	_RUN_UNIT_TEST_(experimental_concurrent_stack_threads_test);
+
+	puts("\nFinished ConcurrentStack Unit Tests...");
+	puts("----------------------------------------------------------");
+}
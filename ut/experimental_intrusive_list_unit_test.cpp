@@ -0,0 +1,147 @@
+/*
+ *	File name:	"experimental_intrusive_list_unit_test.cpp"
+ *	Date:		10/19/2026 7:15:32 AM
+ *	Author:		Vo, Dinh Tue Minh
+ *	Purpose:	Unit tests for experimental intrusive list
+ */
+
+#include "./inc/unit_test.hpp"
+#include "../inc/ds/experimental_intrusive_list.hpp"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace experimental;
+
+namespace {
+	struct Task {
+		int id;
+		std::string name;
+		IntrusiveListHook queueHook;
+		IntrusiveListHook lruHook;
+	};
+
+	using TaskQueue = IntrusiveList<Task, &Task::queueHook>;
+	using TaskLru = IntrusiveList<Task, &Task::lruHook>;
+
+	template<typename L>
+	bool ids_equal(L const &l, std::vector<int> const &expected) {
+		if (l.size() != expected.size()) {
+			return false;
+		}
+		auto it = expected.begin();
+		for (auto const &task : l) {
+			if (task.id != *it++) {
+				return false;
+			}
+		}
+		auto last = l.end();
+		for (auto rit = expected.rbegin(); rit != expected.rend(); ++rit) {
+			if ((--last)->id != *rit) {
+				return false;
+			}
+		}
+		return last == l.begin();
+	}
+}
+
+bool experimental_intrusive_list_insert_erase_test() {
+	std::vector<Task> tasks(6);
+	for (int i = 0; i < 6; ++i) {
+		tasks[i].id = i;
+	}
+	TaskQueue queue;
+	for (auto &task : tasks) {
+		queue.push_back(task);
+	}
+	queue.pop_front();
+	queue.pop_back();
+	// the list holds the objects themselves
+	if (!ids_equal(queue, { 1, 2, 3, 4 }) || &queue.front() != &tasks[1] || tasks[0].queueHook.is_linked()) {
+		return false;
+	}
+	auto it = queue.erase(queue.iterator_to(tasks[2]));
+	queue.insert(it, tasks[5]);
+	queue.push_front(tasks[0]);
+	queue.remove(tasks[4]);
+	if (!ids_equal(queue, { 0, 1, 5, 3 }) || tasks[4].queueHook.is_linked()) {
+		return false;
+	}
+	queue.clear();
+	return queue.empty() && queue.begin() == queue.end() && !tasks[5].queueHook.is_linked();
+}
+
+bool experimental_intrusive_list_two_hooks_test() {
+	std::vector<Task> tasks(4);
+	for (int i = 0; i < 4; ++i) {
+		tasks[i].id = i;
+		tasks[i].name = "task " + std::to_string(i);
+	}
+	TaskQueue queue;
+	TaskLru lru;
+	for (auto &task : tasks) {
+		queue.push_back(task);
+		lru.push_front(task);
+	}
+	// touching an entry moves it to the front of the LRU in O(1), the queue is not changed
+	lru.splice(lru.begin(), lru, lru.iterator_to(tasks[1]));
+	lru.splice(lru.begin(), lru, lru.iterator_to(tasks[2]));
+	if (!ids_equal(lru, { 2, 1, 3, 0 }) || !ids_equal(queue, { 0, 1, 2, 3 })) {
+		return false;
+	}
+	// evict the least recently used
+	Task &evicted = lru.back();
+	lru.pop_back();
+	queue.remove(evicted);
+	// copies are not in any list
+	Task copy = tasks[3];
+	bool passed = evicted.name == "task 0" && ids_equal(lru, { 2, 1, 3 }) && ids_equal(queue, { 1, 2, 3 })
+		&& !copy.queueHook.is_linked() && copy.name == "task 3";
+	queue.clear();
+	lru.clear();
+	return passed;
+}
+
+bool experimental_intrusive_list_splice_move_test() {
+	std::vector<Task> tasks(8);
+	for (int i = 0; i < 8; ++i) {
+		tasks[i].id = i;
+	}
+	TaskQueue a, b;
+	for (int i = 0; i < 4; ++i) {
+		a.push_back(tasks[i]);
+		b.push_back(tasks[i + 4]);
+	}
+	auto first = b.begin();
+	auto last = b.end();
+	a.splice(a.end(), b, ++first, --last);
+	if (!ids_equal(a, { 0, 1, 2, 3, 5, 6 }) || !ids_equal(b, { 4, 7 })) {
+		return false;
+	}
+	a.splice(a.begin(), b);
+	if (!ids_equal(a, { 4, 7, 0, 1, 2, 3, 5, 6 }) || !b.empty()) {
+		return false;
+	}
+	// moving relinks the objects to the new list
+	TaskQueue c = std::move(a);
+	b = std::move(c);
+	b.pop_front();
+	bool passed = a.empty() && c.empty() && ids_equal(b, { 7, 0, 1, 2, 3, 5, 6 });
+	b.clear();
+	return passed;
+}
+
+void experimental_intrusive_list_unit_tests() {
+	puts("----------------------------------------------------------");
+	puts("Running IntrusiveList Unit Tests...\n");
+
+	_RUN_UNIT_TEST_(experimental_intrusive_list_insert_erase_test);
+
+	_RUN_UNIT_TEST_(experimental_intrusive_list_two_hooks_test);
+
+	_RUN_UNIT_TEST_(experimental_intrusive_list_splice_move_test);
+
+	puts("\nFinished IntrusiveList Unit Tests...");
+	puts("----------------------------------------------------------");
+}
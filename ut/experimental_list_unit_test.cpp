@@ -8,6 +8,13 @@
 #include "./inc/unit_test.hpp"
 #include "../inc/ds/experimental_list.hpp"
 
+#include <algorithm>
+#include <memory_resource>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
 using namespace experimental;
 
 bool experimental_list_copy_constructor_test() {
@@ -120,6 +127,218 @@ bool experimental_list_erase_test() {
 	return li.empty();
 }
 
+bool experimental_list_pool_allocator_test() {
+	using PoolList = List<int, PoolAllocator<int>>;
+	constexpr int SZ = 100000;
+	PoolList li;
+	for (int i = 0; i < SZ; ++i) {
+		li.push_back(i);
+	}
+	for (auto it = li.begin(); it != li.end();) {
+		it = (*it % 2) ? li.erase(it) : ++it;
+	}
+	// the erased nodes are reused
+	auto slabs = li.get_allocator().slab_count();
+	for (int i = 0; i < SZ / 2; ++i) {
+		li.push_front(-i);
+	}
+	if (li.size() != SZ || li.get_allocator().slab_count() != slabs || li.front() != -(SZ / 2 - 1) || li.back() != SZ - 2) {
+		return false;
+	}
+	// a copy has its own pool, the pool of a list alone is freed at once
+	PoolList cpy = li;
+	if (cpy.get_allocator() == li.get_allocator() || cpy.size() != SZ) {
+		return false;
+	}
+	li.clear();
+	if (!li.empty() || li.get_allocator().slab_count() != 1) {
+		return false;
+	}
+	li.push_back(7);
+	return li.front() == 7 && li.size() == 1 && cpy.back() == SZ - 2;
+}
+
+bool experimental_list_shared_pool_test() {
+	using PoolList = List<std::string, PoolAllocator<std::string>>;
+	PoolAllocator<std::string> pool(4096);
+	PoolList a(pool), b(pool);
+	for (int i = 0; i < 1000; ++i) {
+		a.push_back(std::to_string(i) + " is long enough not to be a small string");
+		b.push_front(std::to_string(i));
+	}
+	// a shared pool is not reset, the nodes are released one by one
+	a.clear();
+	if (!a.empty() || b.size() != 1000 || b.back() != "0" || pool.slab_count() <= 1) {
+		return false;
+	}
+	b = PoolList(pool);
+	a = PoolList{ "x", "y" };
+	return b.empty() && a.size() == 2 && a.back() == "y" && a.get_allocator() != pool;
+}
+
+namespace {
+	template<typename L>
+	bool list_equals(L const &l, std::vector<typename L::value_type> const &expected) {
+		if (l.size() != expected.size()) {
+			return false;
+		}
+		auto it = expected.begin();
+		for (auto const &e : l) {
+			if (!(e == *it++)) {
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+bool experimental_list_splice_test() {
+	List<int> a{ 1, 2, 3 };
+	List<int> b{ 10, 20, 30, 40 };
+	// single element, then a range, then a whole list
+	auto it = b.begin();
+	a.splice(a.begin(), b, ++it);
+	if (!list_equals(a, { 20, 1, 2, 3 }) || !list_equals(b, { 10, 30, 40 })) {
+		return false;
+	}
+	auto first = b.begin();
+	a.splice(a.end(), b, ++first, b.end());
+	if (!list_equals(a, { 20, 1, 2, 3, 30, 40 }) || !list_equals(b, { 10 })) {
+		return false;
+	}
+	auto pos = a.begin();
+	++pos;
+	a.splice(pos, b);
+	if (!list_equals(a, { 20, 10, 1, 2, 3, 30, 40 }) || !b.empty()) {
+		return false;
+	}
+	// within the list: rotate the first two elements to the back
+	auto last = a.begin();
+	++++last;
+	a.splice(a.end(), a, a.begin(), last);
+	a.splice(a.begin(), List<int>{ 7 });
+	return list_equals(a, { 7, 1, 2, 3, 30, 40, 20, 10 }) && a.size() == 8;
+}
+
+bool experimental_list_merge_test() {
+	List<std::pair<int, char>> a{ { 1, 'a' }, { 3, 'a' }, { 5, 'a' } };
+	List<std::pair<int, char>> b{ { 0, 'b' }, { 3, 'b' }, { 6, 'b' }, { 7, 'b' } };
+	auto byKey = [](std::pair<int, char> const &x, std::pair<int, char> const &y) { return x.first < y.first; };
+	a.merge(b, byKey);
+	if (!b.empty() || !list_equals(a, { { 0, 'b' }, { 1, 'a' }, { 3, 'a' }, { 3, 'b' }, { 5, 'a' }, { 6, 'b' }, { 7, 'b' } })) {
+		return false;
+	}
+	List<int> c{ 5, 3, 1 };
+	List<int> d{ 6, 4 };
+	c.merge(d, std::greater<int>());
+	c.merge(List<int>{});
+	return list_equals(c, { 6, 5, 4, 3, 1 });
+}
+
+bool experimental_list_sort_test() {
+	std::mt19937 gen(42);
+	for (int sz : { 0, 1, 2, 3, 17, 1000, 4097 }) {
+		List<std::pair<int, int>> l;
+		std::vector<std::pair<int, int>> expected;
+		for (int i = 0; i < sz; ++i) {
+			l.push_back({ static_cast<int>(gen() % 50), i });
+			expected.push_back(l.back());
+		}
+		// the nodes are relinked: the elements stay where they are
+		std::vector<std::pair<int, int> const *> addresses;
+		for (auto const &e : l) {
+			addresses.push_back(&e);
+		}
+		auto byKey = [](std::pair<int, int> const &x, std::pair<int, int> const &y) { return x.first < y.first; };
+		l.sort(byKey);
+		std::stable_sort(expected.begin(), expected.end(), byKey);
+		if (!list_equals(l, expected)) {
+			return false;
+		}
+		for (auto const &e : l) {
+			if (addresses[e.second] != &e) {
+				return false;
+			}
+		}
+		// walk backwards to check the previous links
+		std::vector<std::pair<int, int>> backwards;
+		for (auto it = l.end(); it != l.begin();) {
+			backwards.push_back(*--it);
+		}
+		if (!std::equal(backwards.rbegin(), backwards.rend(), expected.begin(), expected.end())) {
+			return false;
+		}
+	}
+	List<std::string> words{ "pear", "apple", "fig" };
+	words.sort();
+	return list_equals(words, { "apple", "fig", "pear" });
+}
+
+bool experimental_list_emplace_test() {
+	// no default constructor: the sentinel holds no value
+	struct Point {
+		int x, y;
+		Point(int x, int y) : x{ x }, y{ y } {}
+		bool operator==(Point const &rhs) const { return x == rhs.x && y == rhs.y; }
+	};
+	List<Point> points;
+	points.emplace_back(1, 2);
+	points.emplace_front(0, 0).y = 1;
+	auto it = points.emplace(points.end(), 5, 5);
+	points.emplace(it, 3, 4);
+	return list_equals(points, { { 0, 1 }, { 1, 2 }, { 3, 4 }, { 5, 5 } }) && points.back().x == 5;
+}
+
+bool experimental_list_move_swap_test() {
+	List<std::string> a{ "a", "b", "c" };
+	List<std::string> b = std::move(a);
+	// the source is a valid empty list
+	a.push_back("d");
+	if (!list_equals(a, { "d" }) || !list_equals(b, { "a", "b", "c" })) {
+		return false;
+	}
+	a.swap(b);
+	if (!list_equals(a, { "a", "b", "c" }) || !list_equals(b, { "d" })) {
+		return false;
+	}
+	List<std::string> empty;
+	b.swap(empty);
+	b.swap(empty);
+	a = std::move(empty);
+	a.emplace_back("e");
+	// the source is left empty, its old elements are destroyed
+	empty.push_back("f");
+	return list_equals(a, { "e" }) && list_equals(b, { "d" }) && list_equals(empty, { "f" });
+}
+
+bool experimental_list_allocator_propagation_test() {
+	// polymorphic allocators do not propagate: the elements move one by one between unequal resources
+	using PmrList = List<std::string, std::pmr::polymorphic_allocator<std::string>>;
+	std::pmr::monotonic_buffer_resource r1, r2;
+	PmrList a(&r1), b(&r2), c(&r1);
+	for (int i = 0; i < 10; ++i) {
+		a.push_back(std::to_string(i) + " is long enough not to be a small string");
+	}
+	b = std::move(a);
+	if (b.get_allocator().resource() != &r2 || !a.empty() || b.size() != 10 || b.back().compare(0, 2, "9 ") != 0) {
+		return false;
+	}
+	c = b;
+	if (c.get_allocator().resource() != &r1 || c.size() != 10 || b.size() != 10) {
+		return false;
+	}
+	// equal allocators: the nodes are taken over
+	std::string const *front = &c.front();
+	a = std::move(c);
+	if (&a.front() != front || !c.empty()) {
+		return false;
+	}
+	a.swap(c);
+	return a.empty() && &c.front() == front
+		&& !noexcept(std::declval<PmrList &>() = std::declval<PmrList &&>())
+		&& noexcept(std::declval<List<int> &>() = std::declval<List<int> &&>());
+}
+
 void experimental_list_unit_tests() {
 	puts("----------------------------------------------------------");
 	puts("Running Vector Unit Tests...\n");
@@ -142,6 +361,22 @@ void experimental_list_unit_tests() {
 
 	_RUN_UNIT_TEST_(experimental_list_erase_test);
 
+	_RUN_UNIT_TEST_(experimental_list_pool_allocator_test);
+
+	_RUN_UNIT_TEST_(experimental_list_shared_pool_test);
+
+	_RUN_UNIT_TEST_(experimental_list_splice_test);
+
+	_RUN_UNIT_TEST_(experimental_list_merge_test);
+
+	_RUN_UNIT_TEST_(experimental_list_sort_test);
+
+	_RUN_UNIT_TEST_(experimental_list_emplace_test);
+
+	_RUN_UNIT_TEST_(experimental_list_move_swap_test);
+
+	_RUN_UNIT_TEST_(experimental_list_allocator_propagation_test);
+
 	puts("\nFinished Vector Unit Tests...");
 	puts("----------------------------------------------------------");
 }
\ No newline at end of file
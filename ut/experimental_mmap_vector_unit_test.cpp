@@ -0,0 +1,171 @@
+/*
+ *	File name:	"experimental_mmap_vector_unit_test.cpp"
+ *	Date:		10/18/2026 11:40:16 PM
+ *	Author:		Vo, Dinh Tue Minh
+ *	Purpose:	Unit tests for experimental mmap vector
+ */
+
+#include "./inc/unit_test.hpp"
+#include "../inc/ds/experimental_mmap_vector.hpp"
+
+#include <cstdio>
+
+#ifdef __linux__
+
+#include <stdexcept>
+#include <string>
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace experimental;
+
+namespace {
+	struct Point {
+		int x;
+		double y;
+	};
+
+	// create an empty temporary file and get its path
+	std::string make_temp_file() {
+		char path[] = "/tmp/experimental_mmap_vector_XXXXXX";
+		int fd = mkstemp(path);
+		if (fd >= 0) {
+			close(fd);
+		}
+		return path;
+	}
+
+	long long file_size(std::string const &path) {
+		struct stat st;
+		return stat(path.c_str(), &st) == 0 ? static_cast<long long>(st.st_size) : -1;
+	}
+}
+
+bool experimental_mmap_vector_persistence_test() {
+	std::string path = make_temp_file();
+	constexpr int N = 100000;
+	{
+		MMapVector<int> v(path);
+		if (!v.empty() || v.read_only()) {
+			return false;
+		}
+		for (int i = 0; i < N; ++i) {
+			v.push_back(i);
+		}
+		v.insert(v.begin(), -1);
+		v.erase(v.begin());
+		v.sync();
+	}
+	// closing cuts the unused capacity off the file
+	bool passed = file_size(path) == static_cast<long long>(N * sizeof(int));
+	{
+		MMapVector<int> v(path);
+		passed = passed && v.size() == N && v[0] == 0 && v[N - 1] == N - 1;
+		v.resize(N / 2);
+		v.push_back(-7);
+	}
+	{
+		MMapVector<int> v(path, MMapMode::READ_ONLY);
+		passed = passed && v.read_only() && v.size() == N / 2 + 1 && v[N / 2 - 1] == N / 2 - 1 && v.back() == -7;
+	}
+	std::remove(path.c_str());
+	return passed;
+}
+
+bool experimental_mmap_vector_struct_test() {
+	std::string path = make_temp_file();
+	{
+		MMapVector<Point> v(path);
+		for (int i = 0; i < 1000; ++i) {
+			v.push_back({ i, i / 2.0 });
+		}
+		v.shrink_to_fit();
+	}
+	bool passed = file_size(path) == static_cast<long long>(1000 * sizeof(Point));
+	{
+		MMapVector<Point> v(path);
+		double total = 0;
+		for (auto const &p : v) {
+			total += p.y;
+		}
+		passed = passed && v.size() == 1000 && v[999].x == 999 && total == 999 * 1000 / 4.0;
+		v.clear();
+	}
+	passed = passed && file_size(path) == 0;
+	std::remove(path.c_str());
+	return passed;
+}
+
+bool experimental_mmap_vector_read_only_test() {
+	std::string path = make_temp_file();
+	{
+		MMapVector<int> v(path);
+		v.push_back(1);
+	}
+	bool passed = false;
+	{
+		MMapVector<int> v(path, MMapMode::READ_ONLY);
+		try {
+			v.push_back(2);		// no room left, cannot grow
+		}
+		catch (std::logic_error const &) {
+			passed = v.size() == 1 && v[0] == 1;
+		}
+	}
+	std::remove(path.c_str());
+	try {
+		MMapVector<int> v(path, MMapMode::READ_ONLY);		// no such file
+		return false;
+	}
+	catch (std::system_error const &) {
+		return passed;
+	}
+}
+
+bool experimental_mmap_vector_move_test() {
+	std::string pathA = make_temp_file();
+	std::string pathB = make_temp_file();
+	bool passed;
+	{
+		MMapVector<int> a(pathA);
+		a.push_back(1);
+		a.push_back(2);
+		MMapVector<int> b(pathB);
+		b.push_back(3);
+
+		MMapVector<int> moved = std::move(a);	// 'a' no longer owns the file
+		swap(moved, b);
+		b = std::move(moved);					// closes pathA, which the swap gave to 'b'
+		passed = a.empty() && moved.empty() && b.size() == 1 && b[0] == 3;
+		b.push_back(4);
+	}
+	passed = passed && file_size(pathA) == 2 * sizeof(int) && file_size(pathB) == 2 * sizeof(int);
+	{
+		MMapVector<int> a(pathA, MMapMode::READ_ONLY);
+		passed = passed && a[1] == 2;
+	}
+	std::remove(pathA.c_str());
+	std::remove(pathB.c_str());
+	return passed;
+}
+
+#endif // __linux__
+
+void experimental_mmap_vector_unit_tests() {
+	puts("----------------------------------------------------------");
+	puts("Running MMapVector Unit Tests...\n");
+
+#ifdef __linux__
+	_RUN_UNIT_TEST_(experimental_mmap_vector_persistence_test);
+
+	_RUN_UNIT_TEST_(experimental_mmap_vector_struct_test);
+
+	_RUN_UNIT_TEST_(experimental_mmap_vector_read_only_test);
+
+	_RUN_UNIT_TEST_(experimental_mmap_vector_move_test);
+#endif
+
+	puts("\nFinished MMapVector Unit Tests...");
+	puts("----------------------------------------------------------");
+}
@@ -0,0 +1,174 @@
+/*
+ *	File name:	"experimental_mpmc_queue_unit_test.cpp"
+ *	Date:		10/19/2026 9:31:07 AM
+ *	Author:		Vo, Dinh Tue Minh
+ *	Purpose:	Unit tests for lock-free MPMC queues
+ */
+
+#include "./inc/unit_test.hpp"
+#include "../inc/ds/experimental_mpmc_queue.hpp"
+
+#include <atomic>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace experimental;
+
+namespace {
+	constexpr int PRODUCERS = 4;
+	constexpr int CONSUMERS = 4;
+	constexpr int ITEMS_PER_PRODUCER = 20000;
+
+	// its copies throw while 'fail' is set, its moves do not
+	struct ThrowingCopy {
+		static bool fail;
+
+		int value;
+
+		ThrowingCopy(int v = 0) : value{ v } {}
+		ThrowingCopy(ThrowingCopy const &t) : value{ t.value } { check(); }
+		ThrowingCopy(ThrowingCopy &&t) noexcept : value{ t.value } {}
+		ThrowingCopy& operator=(ThrowingCopy const &t) { check(); value = t.value; return *this; }
+		ThrowingCopy& operator=(ThrowingCopy &&t) { check(); value = t.value; return *this; }
+
+		static void check() {
+			if (fail) {
+				throw std::runtime_error("copy failed");
+			}
+		}
+	};
+	bool ThrowingCopy::fail = false;
+
+	// every producer pushes its items in order, and every consumer checks that
+	// the items of each producer come in order; all the items must be popped once
+	template<typename Queue>
+	bool concurrent_fifo(Queue &queue) {
+		std::atomic<long long> total{ 0 };
+		std::atomic<int> popped{ 0 };
+		std::atomic<bool> inOrder{ true };
+		std::vector<std::thread> threads;
+		for (int p = 0; p < PRODUCERS; ++p) {
+			threads.emplace_back([&queue, p]() {
+				for (int i = 0; i < ITEMS_PER_PRODUCER; ++i) {
+					queue.push(p * ITEMS_PER_PRODUCER + i);
+				}
+			});
+		}
+		for (int c = 0; c < CONSUMERS; ++c) {
+			threads.emplace_back([&]() {
+				std::vector<int> last(PRODUCERS, -1);
+				int item;
+				while (popped.load() < PRODUCERS * ITEMS_PER_PRODUCER) {
+					if (!queue.try_pop(item)) {
+						std::this_thread::yield();
+						continue;
+					}
+					popped.fetch_add(1);
+					total.fetch_add(item);
+					int producer = item / ITEMS_PER_PRODUCER;
+					if (item <= last[producer]) {
+						inOrder = false;
+					}
+					last[producer] = item;
+				}
+			});
+		}
+		for (auto &t : threads) {
+			t.join();
+		}
+		long long n = static_cast<long long>(PRODUCERS) * ITEMS_PER_PRODUCER;
+		int item;
+		return inOrder && total == n * (n - 1) / 2 && !queue.try_pop(item);
+	}
+}
+
+bool experimental_bounded_mpmc_queue_test() {
+	BoundedMPMCQueue<std::string> strings(5);
+	if (strings.capacity() != 8) {
+		return false;
+	}
+	for (int i = 0; i < 8; ++i) {
+		if (!strings.try_push(std::to_string(i) + " is too long for the small string buffer")) {
+			return false;
+		}
+	}
+	std::string s;
+	if (strings.try_push("full") || !strings.try_pop(s) || s.compare(0, 2, "0 ") != 0 || strings.size_approx() != 7) {
+		return false;
+	}
+	// wrap around, the elements left are destroyed with the queue
+	strings.push("8");
+	for (int i = 1; i < 5; ++i) {
+		if (strings.pop().compare(0, 2, std::to_string(i) + " ") != 0) {
+			return false;
+		}
+	}
+	BoundedMPMCQueue<int> ints(64);
+	return concurrent_fifo(ints);
+}
+
+bool experimental_bounded_mpmc_queue_exception_test() {
+	// a throwing push or pop must not leave a claimed cell behind, the next lap would wait on it
+	BoundedMPMCQueue<ThrowingCopy> queue(2);
+	ThrowingCopy item{ 1 };
+	for (int lap = 0; lap < 3; ++lap) {
+		ThrowingCopy::fail = true;
+		try {
+			queue.try_push(item);
+			return false;
+		}
+		catch (std::runtime_error const &) {}
+		ThrowingCopy::fail = false;
+		if (!queue.try_push(ThrowingCopy{ lap }) || queue.size_approx() != 1) {
+			return false;
+		}
+		// the element is removed even though it cannot be assigned to 'item'
+		ThrowingCopy::fail = true;
+		try {
+			queue.try_pop(item);
+			return false;
+		}
+		catch (std::runtime_error const &) {}
+		ThrowingCopy::fail = false;
+		if (queue.size_approx() != 0 || queue.try_pop(item)) {
+			return false;
+		}
+	}
+	return queue.try_push(item) && queue.try_push(ThrowingCopy{ 2 }) && !queue.try_push(item)
+		&& queue.try_pop(item) && item.value == 1 && queue.try_pop(item) && item.value == 2;
+}
+
+bool experimental_mpmc_queue_test() {
+	MPMCQueue<std::string> strings;
+	std::string s;
+	if (!strings.empty() || strings.try_pop(s)) {
+		return false;
+	}
+	for (int i = 0; i < 1000; ++i) {
+		strings.push(std::to_string(i) + " is too long for the small string buffer");
+	}
+	for (int i = 0; i < 600; ++i) {
+		if (strings.pop().compare(0, std::to_string(i).size() + 1, std::to_string(i) + " ") != 0) {
+			return false;
+		}
+	}
+	MPMCQueue<int> ints;
+	return !strings.empty() && concurrent_fifo(ints);
+}
+
+void experimental_mpmc_queue_unit_tests() {
+	puts("----------------------------------------------------------");
+	puts("Running MPMC Queue Unit Tests...\n");
+
+	_RUN_UNIT_TEST_(experimental_bounded_mpmc_queue_test);
+
+	_RUN_UNIT_TEST_(experimental_bounded_mpmc_queue_exception_test);
+
+	_RUN_UNIT_TEST_(experimental_mpmc_queue_test);
+
+	puts("\nFinished MPMC Queue Unit Tests...");
+	puts("----------------------------------------------------------");
+}
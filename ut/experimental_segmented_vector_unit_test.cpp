@@ -0,0 +1,143 @@
+/*
+ *	File name:	"experimental_segmented_vector_unit_test.cpp"
+ *	Date:		10/19/2026 12:52:08 AM
+ *	Author:		Vo, Dinh Tue Minh
+ *	Purpose:	Unit tests for experimental segmented vector and deque
+ */
+
+#include "./inc/unit_test.hpp"
+#include "../inc/ds/experimental_segmented_vector.hpp"
+#include "../inc/sorts/experimental_insertion_sort.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+using namespace experimental;
+
+bool experimental_segmented_vector_push_back_test() {
+	SegmentedVector<int, 64> v;		// 16 ints per chunk
+	Vector<int *> addresses;
+	for (int i = 0; i < 10000; ++i) {
+		v.push_back(i);
+		addresses.push_back(&v.back());
+	}
+	// the elements never move
+	for (int i = 0; i < 10000; ++i) {
+		if (addresses[i] != &v[i] || v[i] != i) {
+			return false;
+		}
+	}
+	if (v.size() != 10000 || v.capacity() != 10000 || v.front() != 0 || v.back() != 9999) {
+		return false;
+	}
+	try {
+		v.at(10000);
+		return false;
+	}
+	catch (std::out_of_range const &) {}
+
+	v.resize(5);
+	v.resize(7, -1);
+	return v.size() == 7 && v[4] == 4 && v[6] == -1 && v.capacity() == 10000 && v.end() - v.begin() == 7;
+}
+
+bool experimental_segmented_vector_sort_test() {
+	SegmentedVector<int, 64> v;
+	std::mt19937 gen(42);
+	for (int i = 0; i < 2000; ++i) {
+		v.push_back(static_cast<int>(gen() % 1000));
+	}
+	insertion_sort(v.begin(), v.end());
+	if (!std::is_sorted(v.cbegin(), v.cend())) {
+		return false;
+	}
+	std::sort(v.begin(), v.end(), std::greater<int>());
+	auto it = v.begin();
+	it += 10;
+	return std::is_sorted(v.begin(), v.end(), std::greater<int>())
+		&& it[5] == v[15] && *(3 + it) == v[13] && std::distance(v.begin(), v.end()) == 2000;
+}
+
+bool experimental_segmented_vector_copy_move_test() {
+	SegmentedVector<std::string, 128> v;
+	for (int i = 0; i < 100; ++i) {
+		v.emplace_back(std::to_string(i));
+	}
+	SegmentedVector<std::string, 128> cpy = v;
+	std::string const *first = &v[0];
+	SegmentedVector<std::string, 128> moved = std::move(v);	// takes the chunks
+	if (&moved[0] != first || !v.empty() || cpy.size() != 100 || cpy[99] != "99" || moved[50] != "50") {
+		return false;
+	}
+	v = cpy;
+	cpy = std::move(moved);
+	swap(v, cpy);
+	v.shrink_to_fit();
+	return v.size() == 100 && v[0] == "0" && cpy.size() == 100 && cpy[99] == "99" && v.capacity() < 100 + 128;
+}
+
+bool experimental_deque_both_ends_test() {
+	Deque<std::string, 64> d;		// 2 strings per chunk
+	for (int i = 0; i < 500; ++i) {
+		d.push_back(std::to_string(i));
+		d.emplace_front(std::to_string(-i - 1));
+	}
+	// -500 ... -1 0 ... 499
+	if (d.size() != 1000 || d.front() != "-500" || d.back() != "499" || d[499] != "-1" || d[500] != "0") {
+		return false;
+	}
+	std::string const *middle = &d[500];
+	for (int i = 0; i < 400; ++i) {
+		d.pop_front();
+		d.pop_back();
+	}
+	for (int i = 0; i < 300; ++i) {
+		d.push_front("f");
+	}
+	return &d[400] == middle && d.size() == 500 && d[299] == "f" && d[300] == "-100" && d.back() == "99";
+}
+
+bool experimental_deque_queue_test() {
+	Deque<int, 64> d;		// 16 ints per chunk
+	for (int i = 0; i < 100; ++i) {
+		d.push_back(i);
+	}
+	// a queue of 100 elements recycles its chunks
+	for (int i = 100; i < 100000; ++i) {
+		d.push_back(i);
+		if (d.front() != i - 100) {
+			return false;
+		}
+		d.pop_front();
+	}
+	if (d.size() != 100 || d.capacity() > 4 * 112) {
+		return false;
+	}
+	Deque<int, 64> stack;
+	for (int i = 0; i < 1000; ++i) {
+		stack.push_front(i);
+	}
+	return stack.front() == 999 && stack.back() == 0 && std::is_sorted(stack.begin(), stack.end(), std::greater<int>());
+}
+
+void experimental_segmented_vector_unit_tests() {
+	puts("----------------------------------------------------------");
+	puts("Running SegmentedVector Unit Tests...\n");
+
+	_RUN_UNIT_TEST_(experimental_segmented_vector_push_back_test);
+
+	_RUN_UNIT_TEST_(experimental_segmented_vector_sort_test);
+
+	_RUN_UNIT_TEST_(experimental_segmented_vector_copy_move_test);
+
+	_RUN_UNIT_TEST_(experimental_deque_both_ends_test);
+
+	_RUN_UNIT_TEST_(experimental_deque_queue_test);
+
+	puts("\nFinished SegmentedVector Unit Tests...");
+	puts("----------------------------------------------------------");
+}
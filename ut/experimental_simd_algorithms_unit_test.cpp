@@ -0,0 +1,199 @@
+/*
+ *	File name:	"experimental_simd_algorithms_unit_test.cpp"
+ *	Date:		10/19/2026 2:18:45 AM
+ *	Author:		Vo, Dinh Tue Minh
+ *	Purpose:	Unit tests for vectorized algorithms
+ */
+
+#include "./inc/unit_test.hpp"
+#include "../inc/experimental_simd_algorithms.hpp"
+#include "../inc/ds/experimental_vector.hpp"
+#include "../inc/ds/experimental_list.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <numeric>
+#include <random>
+
+using namespace experimental;
+
+namespace {
+	simd::SimdLevel const LEVELS[] = { simd::SimdLevel::SCALAR, simd::SimdLevel::SSE4, simd::SimdLevel::AVX2 };
+
+	// run 'test' with every instruction set the CPU supports
+	template<typename Test>
+	bool for_each_level(Test test) {
+		bool passed = true;
+		for (auto level : LEVELS) {
+			simd::set_simd_level(level);
+			passed = passed && test();
+		}
+		simd::set_simd_level(simd::supported_simd_level());
+		return passed;
+	}
+
+	// random values of 'sz' elements in [0, range)
+	template<typename T>
+	Vector<T> random_values(int sz, int range, unsigned seed) {
+		std::mt19937 gen(seed);
+		Vector<T> v;
+		for (int i = 0; i < sz; ++i) {
+			v.push_back(static_cast<T>(static_cast<int>(gen() % range) - range / 2));
+		}
+		return v;
+	}
+}
+
+bool experimental_simd_find_count_test() {
+	return for_each_level([]() {
+		// every length around the vector widths, so that the scalar tails are covered
+		for (int sz = 0; sz < 70; ++sz) {
+			Vector<int> vi = random_values<int>(sz, 20, sz);
+			Vector<float> vf = random_values<float>(sz, 20, sz);
+			int const *pi = vi.data();
+			float const *pf = vf.data();
+			for (int value = -11; value <= 11; ++value) {
+				if (simd::find(pi, pi + sz, value) != std::find(pi, pi + sz, value)
+					|| simd::find(pf, pf + sz, static_cast<float>(value)) != std::find(pf, pf + sz, static_cast<float>(value))
+					|| simd::count(pi, pi + sz, value) != static_cast<alias::size_type>(std::count(pi, pi + sz, value))
+					|| simd::count(vf, static_cast<float>(value)) != static_cast<alias::size_type>(std::count(pf, pf + sz, static_cast<float>(value)))
+					|| (sz > 0 && simd::find(vi, value) - vi.begin() != std::find(pi, pi + sz, value) - pi)) {
+					return false;
+				}
+			}
+		}
+		return true;
+	});
+}
+
+bool experimental_simd_find_count_conversion_test() {
+	return for_each_level([]() {
+		// a value of another type than the elements compares as std::find and std::count do
+		Vector<int> vi;
+		Vector<float> vf;
+		for (int i = 0; i < 100; ++i) {
+			vi.push_back(i);
+			vf.push_back(i / 10.0f);
+		}
+		int const *pi = vi.data();
+		float const *pf = vf.data();
+		return simd::find(pi, pi + 100, 1.5) == std::find(pi, pi + 100, 1.5)
+			&& simd::find(pi, pi + 100, 7.0) - pi == 7
+			&& simd::count(pi, pi + 100, 4294967297LL) == static_cast<alias::size_type>(std::count(pi, pi + 100, 4294967297LL))
+			&& simd::count(pi, pi + 100, 42LL) == 1
+			&& simd::count(pi, pi + 100, 1e20) == 0 && simd::find(vi, -1e20) == vi.end()
+			&& simd::find(pi, pi + 100, 99u) - pi == 99
+			&& simd::find(pf, pf + 100, 0.1) == std::find(pf, pf + 100, 0.1)
+			&& simd::find(pf, pf + 100, 0.5) - pf == 5
+			&& simd::count(vf, 3) == 1;
+	});
+}
+
+bool experimental_simd_minmax_accumulate_test() {
+	return for_each_level([]() {
+		for (int sz = 1; sz < 70; ++sz) {
+			Vector<int> vi = random_values<int>(sz, 10, sz + 100);
+			Vector<float> vf = random_values<float>(sz, 10, sz + 100);
+			int *pi = vi.data();
+			float *pf = vf.data();
+			// the first smallest and the last greatest element, as std::minmax_element
+			auto ei = simd::minmax_element(pi, pi + sz);
+			auto ef = simd::minmax_element(vf);
+			if (ei != std::minmax_element(pi, pi + sz) || &*ef.first != std::minmax_element(pf, pf + sz).first
+				|| &*ef.second != std::minmax_element(pf, pf + sz).second) {
+				return false;
+			}
+			// small integral floats are added exactly in any order
+			if (simd::accumulate(pi, pi + sz, 7) != std::accumulate(pi, pi + sz, 7)
+				|| simd::accumulate(vf, 0.5f) != std::accumulate(pf, pf + sz, 0.5f)) {
+				return false;
+			}
+		}
+		Vector<int> empty;
+		return simd::minmax_element(empty.data(), empty.data()).first == empty.data() && simd::accumulate(empty, 3) == 3;
+	});
+}
+
+bool experimental_simd_equal_test() {
+	return for_each_level([]() {
+		for (int sz = 0; sz < 70; ++sz) {
+			Vector<int> a = random_values<int>(sz, 1000, sz);
+			Vector<int> b = a;
+			if (!simd::equal(a, b) || !simd::equal(a.data(), a.data() + sz, b.data())) {
+				return false;
+			}
+			for (int i = 0; i < sz; ++i) {
+				b[i] += 1;
+				if (simd::equal(a, b)) {
+					return false;
+				}
+				b[i] -= 1;
+			}
+		}
+		Vector<float> x{ 0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f };
+		Vector<float> y{ -0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f };
+		Vector<int> shorter{ 1, 2 };
+		// compared as values, not bytes
+		return simd::equal(x, y) && !simd::equal(shorter, Vector<int>{ 1, 2, 3 });
+	});
+}
+
+bool experimental_simd_lower_bound_test() {
+	Vector<int> empty;
+	if (simd::lower_bound(empty, 0) != empty.end()) {
+		return false;
+	}
+	for (int sz = 1; sz < 100; ++sz) {
+		Vector<int> v = random_values<int>(sz, 40, sz);
+		std::sort(v.begin(), v.end());
+		for (int value = -22; value <= 22; ++value) {
+			if (simd::lower_bound(v.begin(), v.end(), value) != std::lower_bound(v.begin(), v.end(), value)
+				|| simd::lower_bound(v, value) != std::lower_bound(v.begin(), v.end(), value)) {
+				return false;
+			}
+		}
+		std::sort(v.begin(), v.end(), std::greater<int>());
+		for (int value = -22; value <= 22; ++value) {
+			if (simd::lower_bound(v.begin(), v.end(), value, std::greater<int>())
+				!= std::lower_bound(v.begin(), v.end(), value, std::greater<int>())) {
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+bool experimental_simd_scalar_fallback_test() {
+	// not contiguous nor a vectorized type: the scalar loops
+	List<int> l;
+	for (int i = 0; i < 10; ++i) {
+		l.push_back(i % 4);
+	}
+	Vector<double> d{ 1.5, -2.0, 3.25, -2.0 };
+	auto extremes = simd::minmax_element(d.begin(), d.end());
+	return *simd::find(l.begin(), l.end(), 3) == 3 && simd::count(l.begin(), l.end(), 1) == 3
+		&& simd::accumulate(l.begin(), l.end(), 0) == 13 && simd::equal(l.begin(), l.end(), l.begin())
+		&& simd::find(l.begin(), l.end(), 9) == l.end()
+		&& *extremes.first == -2.0 && extremes.first - d.begin() == 1 && *extremes.second == 3.25
+		&& simd::accumulate(d, 0.0) == 0.75 && simd::count(d, -2.0) == 2;
+}
+
+void experimental_simd_algorithms_unit_tests() {
+	puts("----------------------------------------------------------");
+	puts("Running SIMD Algorithms Unit Tests...\n");
+
+	_RUN_UNIT_TEST_(experimental_simd_find_count_test);
+
+	_RUN_UNIT_TEST_(experimental_simd_find_count_conversion_test);
+
+	_RUN_UNIT_TEST_(experimental_simd_minmax_accumulate_test);
+
+	_RUN_UNIT_TEST_(experimental_simd_equal_test);
+
+	_RUN_UNIT_TEST_(experimental_simd_lower_bound_test);
+
+	_RUN_UNIT_TEST_(experimental_simd_scalar_fallback_test);
+
+	puts("\nFinished SIMD Algorithms Unit Tests...");
+	puts("----------------------------------------------------------");
+}
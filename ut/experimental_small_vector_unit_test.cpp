@@ -0,0 +1,152 @@
+/*
+ *	File name:	"experimental_small_vector_unit_test.cpp"
+ *	Date:		10/18/2026 8:51:02 PM
+ *	Author:		Vo, Dinh Tue Minh
+ *	Purpose:	Unit tests for experimental small vector
+ */
+
+#include "./inc/unit_test.hpp"
+#include "../inc/ds/experimental_small_vector.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+using namespace experimental;
+
+namespace {
+	// standard allocator that counts its allocations
+	template<typename T>
+	struct CountingAllocator {
+		using value_type = T;
+
+		static int allocations;
+
+		CountingAllocator() = default;
+		template<typename U>
+		CountingAllocator(CountingAllocator<U> const &) {}
+
+		T* allocate(std::size_t n) { ++allocations; return std::allocator<T>().allocate(n); }
+		void deallocate(T *p, std::size_t n) { std::allocator<T>().deallocate(p, n); }
+
+		friend bool operator==(CountingAllocator const &, CountingAllocator const &) { return true; }
+		friend bool operator!=(CountingAllocator const &, CountingAllocator const &) { return false; }
+	};
+	template<typename T>
+	int CountingAllocator<T>::allocations = 0;
+
+	// sum the elements through the Vector interface
+	template<typename T, typename Allocator>
+	T sum(Vector<T, Allocator> const &v) {
+		T total{};
+		for (auto it = v.begin(), end = v.end(); it != end; ++it) {
+			total += *it;
+		}
+		return total;
+	}
+}
+
+bool experimental_small_vector_inline_test() {
+	CountingAllocator<int>::allocations = 0;
+	SmallVector<int, 8, CountingAllocator<int>> v;
+	for (int i = 0; i < 6; ++i) {
+		v.push_back(i);
+	}
+	v.insert(v.begin(), 2, -1);
+	v.erase(v.begin(), v.begin() + 2);
+	// no allocation while the elements fit inline
+	return CountingAllocator<int>::allocations == 0 && v.is_small()
+		&& v.capacity() == 8 && v.size() == 6 && v[5] == 5 && sum(v) == 15;
+}
+
+bool experimental_small_vector_spill_test() {
+	CountingAllocator<std::string>::allocations = 0;
+	SmallVector<std::string, 4, CountingAllocator<std::string>> v;
+	for (int i = 0; i < 100; ++i) {
+		v.emplace_back(std::to_string(i));
+	}
+	if (v.is_small() || CountingAllocator<std::string>::allocations == 0 || v[99] != "99" || v[0] != "0") {
+		return false;
+	}
+	v.clear();
+	return v.empty() && !v.is_small() && v.capacity() >= 100;
+}
+
+bool experimental_small_vector_copy_move_test() {
+	SmallVector<std::string, 4> small{ "a", "b" };
+	SmallVector<std::string, 4> large;
+	for (int i = 0; i < 10; ++i) {
+		large.push_back(std::to_string(i));
+	}
+
+	SmallVector<std::string, 4> smallCpy = small;
+	SmallVector<std::string, 4> largeCpy = large;
+	SmallVector<std::string, 4> smallMoved = std::move(smallCpy);	// element-wise
+	SmallVector<std::string, 4> largeMoved = std::move(largeCpy);	// takes the heap storage
+	if (!smallCpy.empty() || !largeCpy.empty() || !smallCpy.is_small() || !largeCpy.is_small()
+		|| !smallMoved.is_small() || largeMoved.is_small() || smallMoved[1] != "b" || largeMoved[9] != "9") {
+		return false;
+	}
+
+	smallMoved = large;
+	largeMoved = small;
+	swap(smallMoved, largeMoved);
+	if (smallMoved.size() != 2 || smallMoved[0] != "a" || largeMoved.size() != 10 || largeMoved[9] != "9") {
+		return false;
+	}
+
+	// inline elements moved into a vector on the heap, then the heap storage of a small vector moved away
+	largeMoved = std::move(small);
+	if (largeMoved.size() != 2 || largeMoved[1] != "b" || largeMoved.is_small() || !small.empty() || !small.is_small()) {
+		return false;
+	}
+	small = std::move(largeMoved);
+	if (small.size() != 2 || small.is_small() || !largeMoved.is_small() || largeMoved.capacity() != 4) {
+		return false;
+	}
+
+	// a plain vector takes over the heap storage of a small vector, which then allocates again
+	Vector<std::string> plain = std::move(large);
+	large.push_back("x");
+	return plain.size() == 10 && plain[9] == "9" && large.size() == 1 && large[0] == "x"
+		&& std::is_nothrow_move_constructible<Vector<std::string>>::value
+		&& std::is_nothrow_move_constructible<SmallVector<std::string, 4>>::value;
+}
+
+bool experimental_small_vector_shrink_to_fit_test() {
+	SmallVector<std::string, 4> v;
+	for (int i = 0; i < 10; ++i) {
+		v.push_back(std::to_string(i));
+	}
+	v.resize(3);
+	v.shrink_to_fit();		// back to the inline storage
+	if (!v.is_small() || v.capacity() != 4 || v.size() != 3 || v[2] != "2") {
+		return false;
+	}
+	// shrunk below the inline capacity through the base class: moving into it goes back inline
+	SmallVector<std::string, 4> w;
+	for (int i = 0; i < 10; ++i) {
+		w.push_back(std::to_string(i));
+	}
+	w.resize(2);
+	static_cast<Vector<std::string> &>(w).shrink_to_fit();
+	w = std::move(v);
+	return w.is_small() && w.size() == 3 && w[2] == "2";
+}
+
+void experimental_small_vector_unit_tests() {
+	puts("----------------------------------------------------------");
+	puts("Running SmallVector Unit Tests...\n");
+
+	_RUN_UNIT_TEST_(experimental_small_vector_inline_test);
+
+	_RUN_UNIT_TEST_(experimental_small_vector_spill_test);
+
+	_RUN_UNIT_TEST_(experimental_small_vector_copy_move_test);
+
+	_RUN_UNIT_TEST_(experimental_small_vector_shrink_to_fit_test);
+
+	puts("\nFinished SmallVector Unit Tests...");
+	puts("----------------------------------------------------------");
+}
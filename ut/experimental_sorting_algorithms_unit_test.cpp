@@ -12,6 +12,7 @@
 #include "../inc/sorts/experimental_shell_sort.hpp"
 #include "../inc/sorts/experimental_merge_sort.hpp"
 #include "../inc/sorts/experimental_quick_sort.hpp"
+#include "../inc/experimental_operation_counters.hpp"
 
 #include <functional>
 #include <algorithm>
@@ -277,6 +278,51 @@ bool experimental_quick_sort_array_test() {
 	return true;
 }
 
+bool experimental_counted_sort_test() {
+	constexpr int SZ = 1000;
+	int vi[SZ];
+	generate_random_numbers(vi, SZ);
+	int sorted[SZ];
+	for (int i = 0; i < SZ; ++i) {
+		sorted[i] = vi[i];
+	}
+	std::sort(sorted, sorted + SZ);
+
+	// every sort must run on Counted<T> and count some operations
+	using Sort = void (*)(Counted<int> *, alias::size_type, std::less<Counted<int>>);
+	Sort sorts[] = { heap_sort, merge_sort, quick_sort, shell_sort, insertion_sort };
+	for (Sort sort : sorts) {
+		Counted<int> ci[SZ];
+		for (int i = 0; i < SZ; ++i) {
+			ci[i] = Counted<int>{ vi[i] };
+		}
+		operation_counts().reset();
+		sort(ci, SZ, std::less<Counted<int>>());
+		OperationCounts counts = operation_counts();
+		if (counts.comparisons < SZ - 1 || counts.moves + counts.swaps == 0) {
+			return false;
+		}
+		for (int i = 0; i < SZ; ++i) {
+			if (ci[i].value() != sorted[i]) {
+				return false;
+			}
+		}
+	}
+
+	// heap sort does exactly SZ - 1 swaps to move the roots to the back
+	Counted<int> ci[SZ];
+	operation_counts().reset();
+	heap_sort(ci);
+	return operation_counts().swaps == SZ - 1 && operation_counts().copies == 0;
+}
+
+bool experimental_counting_comparator_test() {
+	int vi[] = { 3, 1, 2 };
+	operation_counts().reset();
+	insertion_sort(vi, CountingComparator<std::less<int>>());
+	// insertion sort on 3 elements: 1 comparison for '1', 2 comparisons for '2'
+	return operation_counts().comparisons == 3 && vi[0] == 1 && vi[1] == 2 && vi[2] == 3;
+}
 
 void experimental_sorting_algorithms_unit_tests() {
 	puts("----------------------------------------------------------");
@@ -292,6 +338,10 @@ void experimental_sorting_algorithms_unit_tests() {
 
 	_RUN_UNIT_TEST_(experimental_quick_sort_array_test);
 
+	_RUN_UNIT_TEST_(experimental_counted_sort_test);
+
+	_RUN_UNIT_TEST_(experimental_counting_comparator_test);
+
 	puts("\nFinished Sorting Algorithm Unit Tests...");
 	puts("----------------------------------------------------------");
 }
\ No newline at end of file
@@ -0,0 +1,120 @@
+/*
+ *	File name:	"experimental_spsc_queue_unit_test.cpp"
+ *	Date:		10/19/2026 1:52:36 PM
+ *	Author:		Vo, Dinh Tue Minh
+ *	Purpose:	Unit tests for the SPSC ring buffer
+ */
+
+#include "./inc/unit_test.hpp"
+#include "../inc/ds/experimental_spsc_queue.hpp"
+
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace experimental;
+
+bool experimental_spsc_queue_push_pop_test() {
+	SPSCQueue<std::string> strings(3);
+	if (strings.capacity() != 4 || !strings.empty()) {
+		return false;
+	}
+	for (int round = 0; round < 3; ++round) {
+		// the second and third rounds wrap around the end of the ring
+		for (int i = 0; i < 3; ++i) {
+			if (!strings.try_push(std::to_string(i) + " is too long for the small string buffer")) {
+				return false;
+			}
+		}
+		for (int i = 0; i < 3; ++i) {
+			if (strings.pop().compare(0, 2, std::to_string(i) + " ") != 0) {
+				return false;
+			}
+		}
+	}
+	strings.push("kept");
+	strings.push("until");
+	strings.push("the");
+	strings.push("destructor");
+	std::string s;
+	return !strings.try_push("full") && strings.size_approx() == 4 && strings.try_pop(s) && s == "kept";
+}
+
+bool experimental_spsc_queue_batch_test() {
+	SPSCQueue<int> ints(8);
+	int in[10] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+	int out[10] = {};
+	// move the ring to index 5, so that the next batches wrap
+	if (ints.push_n(in, 5) != 5 || ints.pop_n(out, 10) != 5) {
+		return false;
+	}
+	if (ints.push_n(in, 10) != 8 || ints.push_n(in, 1) != 0) {
+		return false;
+	}
+	if (ints.pop_n(out, 6) != 6 || ints.pop_n(out + 6, 10) != 2 || ints.pop_n(out, 1) != 0) {
+		return false;
+	}
+	for (int i = 0; i < 8; ++i) {
+		if (out[i] != i) {
+			return false;
+		}
+	}
+	SPSCQueue<std::string> strings(4);
+	std::string words[3] = { "a", "b", "c" }, popped[3];
+	strings.push_n(words, 3);
+	strings.pop_n(popped, 1);
+	strings.push_n(words, 2);
+	return strings.pop_n(popped, 3) == 3 && popped[0] == "b" && popped[1] == "c" && popped[2] == "a"
+		&& strings.size_approx() == 1;
+}
+
+// a producer and a consumer pass ITEMS ints in batches of varying sizes, in order
+bool experimental_spsc_queue_threads_test() {
+	constexpr int ITEMS = 200000;
+	SPSCQueue<int> ints(64);
+	std::thread producer([&ints]() {
+		std::vector<int> batch;
+		int next = 0;
+		while (next < ITEMS) {
+			batch.clear();
+			for (int i = 0; i < next % 37 + 1 && next + i < ITEMS; ++i) {
+				batch.push_back(next + i);
+			}
+			next += static_cast<int>(ints.push_n(batch.data(), batch.size()));
+			if (next % 5 == 0 && next < ITEMS) {
+				ints.push(next++);
+			}
+		}
+	});
+	bool inOrder = true;
+	int expected = 0;
+	int buffer[50];
+	while (expected < ITEMS) {
+		auto count = static_cast<int>(ints.pop_n(buffer, expected % 50 + 1));
+		for (int i = 0; i < count; ++i) {
+			inOrder = inOrder && buffer[i] == expected + i;
+		}
+		expected += count;
+		int item;
+		if (count == 0 && ints.try_pop(item)) {
+			inOrder = inOrder && item == expected++;
+		}
+	}
+	producer.join();
+	return inOrder && ints.empty();
+}
+
+void experimental_spsc_queue_unit_tests() {
+	puts("----------------------------------------------------------");
+	puts("Running SPSC Queue Unit Tests...\n");
+
+	_RUN_UNIT_TEST_(experimental_spsc_queue_push_pop_test);
+
+	_RUN_UNIT_TEST_(experimental_spsc_queue_batch_test);
+
+	_RUN_UNIT_TEST_(experimental_spsc_queue_threads_test);
+
+	puts("\nFinished SPSC Queue Unit Tests...");
+	puts("----------------------------------------------------------");
+}
@@ -7,10 +7,35 @@
 
 #include "./inc/unit_test.hpp"
 #include "../inc/ds/experimental_stack.hpp"
-#include "../inc/ds/experimental_vector.hpp"
+#include "../inc/ds/experimental_list.hpp"
+
+#include <stdexcept>
+#include <string>
 
 using namespace experimental;
 
+namespace {
+	// throws from its copy and move constructors once a countdown reaches 0, counts its live objects
+	struct ThrowingElement {
+		static int live;
+		static int countdown;
+
+		ThrowingElement() { ++live; }
+		ThrowingElement(ThrowingElement const &) { count(); }
+		ThrowingElement(ThrowingElement &&) { count(); }
+		~ThrowingElement() { --live; }
+
+		static void count() {
+			if (countdown-- == 0) {
+				throw std::runtime_error("construction failed");
+			}
+			++live;
+		}
+	};
+	int ThrowingElement::live = 0;
+	int ThrowingElement::countdown = -1;
+}
+
 bool experimental_stack_empty_test() {
 	Stack<int> si;
 	return si.empty() && si.size() == 0;
@@ -37,7 +62,7 @@ bool experimental_stack_push_pop_test() {
 }
 
 bool experimental_stack_custom_container_test() {
-	Stack<int, Vector<int>> si;
+	Stack<int, List<int>> si;
 	for (int i = 0; i < 10; ++i) {
 		si.push(i);
 	}
@@ -51,6 +76,104 @@ bool experimental_stack_custom_container_test() {
 	return si.size() == 6 && si.top() == 0;
 }
 
+bool experimental_static_stack_push_pop_test() {
+	StaticStack<int, 8> si;
+	if (!si.empty() || si.capacity() != 8) {
+		return false;
+	}
+	for (int i = 0; i < 8; ++i) {
+		si.push(i);
+	}
+	if (!si.full() || si.top() != 7) {
+		return false;
+	}
+	for (int i = 7; i >= 0; --i) {
+		if (si.top() != i) {
+			return false;
+		}
+		si.pop();
+	}
+	return si.empty();
+}
+
+bool experimental_static_stack_copy_move_test() {
+	StaticStack<std::string, 4> ss;
+	ss.emplace(3, 'a');
+	ss.push("long enough to live on the heap");
+	StaticStack<std::string, 4> copy(ss);
+	StaticStack<std::string, 4> moved(std::move(ss));
+	if (!ss.empty() || copy.size() != 2 || moved.size() != 2 || copy.top() != moved.top()) {
+		return false;
+	}
+	copy.pop();
+	ss = copy;
+	return ss.size() == 1 && ss.top() == "aaa";
+}
+
+bool experimental_static_stack_exception_safety_test() {
+	StaticStack<ThrowingElement, 8> ss;
+	for (int i = 0; i < 5; ++i) {
+		ss.emplace();
+	}
+	// the copy and the move throw on their fourth element and must destroy the three before it
+	ThrowingElement::countdown = 3;
+	try {
+		StaticStack<ThrowingElement, 8> copy(ss);
+		return false;
+	}
+	catch (std::runtime_error const &) {}
+	if (ThrowingElement::live != 5) {
+		return false;
+	}
+	ThrowingElement::countdown = 3;
+	try {
+		StaticStack<ThrowingElement, 8> moved(std::move(ss));
+		return false;
+	}
+	catch (std::runtime_error const &) {}
+	ThrowingElement::countdown = -1;
+	return ThrowingElement::live == 5 && ss.size() == 5;
+}
+
+// sort with an explicit stack of ranges, the use case of StaticStack
+bool experimental_static_stack_explicit_recursion_test() {
+	constexpr int SZ = 1000;
+	int arr[SZ];
+	for (int i = 0; i < SZ; ++i) {
+		arr[i] = (i * 7919) % SZ;
+	}
+	struct Range { int left, right; };
+	// pushing the larger part first keeps the depth under log2(SZ) + 1
+	StaticStack<Range, 16> ranges;
+	ranges.push({ 0, SZ - 1 });
+	while (!ranges.empty()) {
+		Range r = ranges.top();
+		ranges.pop();
+		if (r.left >= r.right) {
+			continue;
+		}
+		int pivot = arr[r.right], i = r.left;
+		for (int j = r.left; j < r.right; ++j) {
+			if (arr[j] < pivot) {
+				std::swap(arr[i++], arr[j]);
+			}
+		}
+		std::swap(arr[i], arr[r.right]);
+		Range lower{ r.left, i - 1 }, upper{ i + 1, r.right };
+		if (lower.right - lower.left > upper.right - upper.left) {
+			std::swap(lower, upper);
+		}
+		ranges.push(upper);
+		ranges.push(lower);
+	}
+	for (int i = 0; i < SZ; ++i) {
+		if (arr[i] != i) {
+			return false;
+		}
+	}
+	return true;
+}
+
 void experimental_stack_unit_test() {
 	puts("----------------------------------------------------------");
 	puts("Running Stack Unit Tests...\n");
@@ -63,6 +186,14 @@ void experimental_stack_unit_test() {
 
 	_RUN_UNIT_TEST_(experimental_stack_custom_container_test);
 
+	_RUN_UNIT_TEST_(experimental_static_stack_push_pop_test);
+
+	_RUN_UNIT_TEST_(experimental_static_stack_copy_move_test);
+
+	_RUN_UNIT_TEST_(experimental_static_stack_exception_safety_test);
+
+	_RUN_UNIT_TEST_(experimental_static_stack_explicit_recursion_test);
+
 	puts("\nFinished Stack Unit Tests...");
 	puts("----------------------------------------------------------");
 }
\ No newline at end of file
@@ -0,0 +1,346 @@
+/*
+ *	File name:	"experimental_unrolled_list_unit_test.cpp"
+ *	Date:		10/19/2026 5:48:20 AM
+ *	Author:		Vo, Dinh Tue Minh
+ *	Purpose:	Unit tests for experimental unrolled list
+ */
+
+#include "./inc/unit_test.hpp"
+#include "../inc/ds/experimental_unrolled_list.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <functional>
+#include <memory_resource>
+#include <random>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace experimental;
+
+namespace {
+	template<typename L>
+	bool list_equals(L const &l, std::vector<typename L::value_type> const &expected) {
+		if (l.size() != expected.size()) {
+			return false;
+		}
+		auto it = expected.begin();
+		for (auto const &e : l) {
+			if (!(e == *it++)) {
+				return false;
+			}
+		}
+		// walk backwards to check the links between the blocks
+		auto last = l.end();
+		for (auto rit = expected.rbegin(); rit != expected.rend(); ++rit) {
+			if (!(*--last == *rit)) {
+				return false;
+			}
+		}
+		return last == l.begin();
+	}
+
+	// records the addresses of its live objects, and if one was copied or moved from a dead object
+	struct TracksLifetime {
+		static std::set<TracksLifetime const *> alive;
+		static bool readDead;
+
+		int value;
+
+		TracksLifetime(int v) : value{ v } { alive.insert(this); }
+		TracksLifetime(TracksLifetime const &t) : value{ read(t) } { alive.insert(this); }
+		TracksLifetime(TracksLifetime &&t) noexcept : value{ read(t) } { alive.insert(this); }
+		TracksLifetime& operator=(TracksLifetime const &t) { value = read(t); return *this; }
+		TracksLifetime& operator=(TracksLifetime &&t) noexcept { value = read(t); return *this; }
+		~TracksLifetime() { alive.erase(this); }
+
+		bool operator==(TracksLifetime const &rhs) const { return value == read(rhs); }
+
+		static int read(TracksLifetime const &t) {
+			readDead = readDead || alive.count(&t) == 0;
+			return t.value;
+		}
+	};
+	std::set<TracksLifetime const *> TracksLifetime::alive;
+	bool TracksLifetime::readDead = false;
+}
+
+bool experimental_unrolled_list_push_pop_test() {
+	using L = UnrolledList<int, 64>;
+	L li;
+	std::vector<int> expected;
+	constexpr int SZ = 1000;
+	for (int i = 0; i < SZ; ++i) {
+		li.push_back(i);
+		li.push_front(-i);
+		expected.push_back(i);
+		expected.insert(expected.begin(), -i);
+	}
+	// pushing at the ends fills whole blocks
+	if (!list_equals(li, expected) || li.block_count() != (2 * SZ + L::BLOCK_SIZE - 1) / L::BLOCK_SIZE + 1) {
+		return false;
+	}
+	for (int i = 0; i < SZ / 2; ++i) {
+		li.pop_front();
+		li.pop_back();
+	}
+	expected.erase(expected.begin(), expected.begin() + SZ / 2);
+	expected.erase(expected.end() - SZ / 2, expected.end());
+	if (!list_equals(li, expected) || li.front() != -(SZ / 2 - 1) || li.back() != SZ / 2 - 1) {
+		return false;
+	}
+	while (!li.empty()) {
+		li.pop_back();
+	}
+	return li.block_count() == 0 && li.begin() == li.end();
+}
+
+bool experimental_unrolled_list_insert_erase_test() {
+	UnrolledList<std::string, 128> li;
+	std::vector<std::string> expected;
+	std::mt19937 gen(3);
+	for (int round = 0; round < 5000; ++round) {
+		std::size_t pos = expected.empty() ? 0 : gen() % (expected.size() + 1);
+		auto it = li.begin();
+		for (std::size_t k = 0; k < pos; ++k) {
+			++it;
+		}
+		if (gen() % 3 != 0 || pos == expected.size()) {
+			// strings too long for the small string optimization
+			std::string item = std::to_string(round) + " is not a short string at all";
+			if (*li.insert(it, item) != item) {
+				return false;
+			}
+			expected.insert(expected.begin() + pos, item);
+		}
+		else {
+			auto next = li.erase(it);
+			expected.erase(expected.begin() + pos);
+			if (pos < expected.size() ? *next != expected[pos] : next != li.end()) {
+				return false;
+			}
+		}
+	}
+	if (!list_equals(li, expected)) {
+		return false;
+	}
+	// the blocks stay at least a quarter full on average
+	if (li.block_count() * decltype(li)::BLOCK_SIZE > 4 * li.size() + 4 * decltype(li)::BLOCK_SIZE) {
+		return false;
+	}
+	auto from = li.begin();
+	auto to = li.begin();
+	for (int k = 0; k < 10; ++k) {
+		++from;
+	}
+	for (int k = 0; k < 300; ++k) {
+		++to;
+	}
+	auto after = li.erase(from, to);
+	expected.erase(expected.begin() + 10, expected.begin() + 300);
+	return *after == expected[10] && list_equals(li, expected);
+}
+
+bool experimental_unrolled_list_insert_own_element_test() {
+	// insert copies of elements of a full block into its middle: the block is split first
+	using L = UnrolledList<TracksLifetime, 256>;
+	L li;
+	std::vector<TracksLifetime> expected;
+	for (int i = 0; i < static_cast<int>(L::BLOCK_SIZE); ++i) {
+		expected.emplace_back(i);
+		li.push_back(expected.back());
+	}
+	auto pos = li.begin();
+	auto last = li.end();
+	++pos;
+	--last;
+	li.insert(pos, *last);
+	expected.insert(expected.begin() + 1, expected.back());
+	auto first = li.begin();
+	pos = li.begin();
+	for (int k = 0; k < 6; ++k) {
+		++pos;
+	}
+	li.emplace(pos, *first);
+	expected.insert(expected.begin() + 6, expected.front());
+	return list_equals(li, expected) && li.block_count() == 2 && !TracksLifetime::readDead;
+}
+
+bool experimental_unrolled_list_splice_test() {
+	using L = UnrolledList<int, 64>;
+	L a{ 1, 2, 3 };
+	L b{ 10, 20, 30, 40 };
+	// single element, then a range, then a whole list
+	auto it = b.begin();
+	a.splice(a.begin(), b, ++it);
+	if (!list_equals(a, { 20, 1, 2, 3 }) || !list_equals(b, { 10, 30, 40 })) {
+		return false;
+	}
+	auto first = b.begin();
+	a.splice(a.end(), b, ++first, b.end());
+	if (!list_equals(a, { 20, 1, 2, 3, 30, 40 }) || !list_equals(b, { 10 })) {
+		return false;
+	}
+	auto pos = a.begin();
+	++pos;
+	a.splice(pos, b);
+	if (!list_equals(a, { 20, 10, 1, 2, 3, 30, 40 }) || !b.empty() || b.block_count() != 0) {
+		return false;
+	}
+	// within the list: rotate the first two elements to the back
+	auto last = a.begin();
+	++++last;
+	a.splice(a.end(), a, a.begin(), last);
+	a.splice(a.begin(), L{ 7 });
+	if (!list_equals(a, { 7, 1, 2, 3, 30, 40, 20, 10 }) || a.size() != 8) {
+		return false;
+	}
+	// a whole list is relinked into the middle of a block: its elements stay where they are
+	L c;
+	std::vector<int> expected;
+	for (int i = 0; i < 100; ++i) {
+		c.push_back(100 + i);
+		expected.push_back(100 + i);
+	}
+	int const *front = &c.front();
+	auto blocks = a.block_count() + c.block_count();
+	pos = a.begin();
+	for (int k = 0; k < 5; ++k) {
+		++pos;
+	}
+	a.splice(pos, c);
+	expected.insert(expected.begin(), { 7, 1, 2, 3, 30 });
+	expected.insert(expected.end(), { 40, 20, 10 });
+	auto moved = a.begin();
+	for (int k = 0; k < 5; ++k) {
+		++moved;
+	}
+	return list_equals(a, expected) && c.empty() && &*moved == front && a.block_count() == blocks + 1;
+}
+
+bool experimental_unrolled_list_merge_test() {
+	UnrolledList<std::pair<int, char>, 64> a{ { 1, 'a' }, { 3, 'a' }, { 5, 'a' } };
+	UnrolledList<std::pair<int, char>, 64> b{ { 0, 'b' }, { 3, 'b' }, { 6, 'b' }, { 7, 'b' } };
+	auto byKey = [](std::pair<int, char> const &x, std::pair<int, char> const &y) { return x.first < y.first; };
+	a.merge(b, byKey);
+	if (!b.empty() || !list_equals(a, { { 0, 'b' }, { 1, 'a' }, { 3, 'a' }, { 3, 'b' }, { 5, 'a' }, { 6, 'b' }, { 7, 'b' } })) {
+		return false;
+	}
+	UnrolledList<int, 64> c{ 5, 3, 1 };
+	UnrolledList<int, 64> d{ 6, 4 };
+	c.merge(d, std::greater<int>());
+	c.merge(UnrolledList<int, 64>{});
+	// all the elements go after or before: the blocks are relinked
+	c.merge(UnrolledList<int, 64>{ 1, 0 }, std::greater<int>());
+	c.merge(UnrolledList<int, 64>{ 9, 8, 6 }, std::greater<int>());
+	return list_equals(c, { 9, 8, 6, 6, 5, 4, 3, 1, 1, 0 });
+}
+
+bool experimental_unrolled_list_sort_test() {
+	std::mt19937 gen(42);
+	for (int sz : { 0, 1, 2, 3, 17, 1000, 4097 }) {
+		UnrolledList<std::pair<int, int>, 128> l;
+		std::vector<std::pair<int, int>> expected;
+		for (int i = 0; i < sz; ++i) {
+			l.push_back({ static_cast<int>(gen() % 50), i });
+			expected.push_back(l.back());
+		}
+		auto byKey = [](std::pair<int, int> const &x, std::pair<int, int> const &y) { return x.first < y.first; };
+		l.sort(byKey);
+		std::stable_sort(expected.begin(), expected.end(), byKey);
+		if (!list_equals(l, expected)) {
+			return false;
+		}
+	}
+	UnrolledList<std::string> words{ "pear", "apple", "fig" };
+	words.sort();
+	return list_equals(words, { "apple", "fig", "pear" });
+}
+
+bool experimental_unrolled_list_copy_move_test() {
+	UnrolledList<int> a{ 1, 2, 3 };
+	for (int i = 4; i <= 200; ++i) {
+		a.push_back(i);
+	}
+	UnrolledList<int> b = a;
+	UnrolledList<int> c = std::move(a);
+	if (!a.empty() || a.begin() != a.end() || b.size() != 200 || c.size() != 200 || b.back() != 200 || c.front() != 1) {
+		return false;
+	}
+	a = b;
+	b = UnrolledList<int>{ 7 };
+	a.push_back(201);
+	return a.size() == 201 && a.back() == 201 && b.size() == 1 && b.front() == 7;
+}
+
+bool experimental_unrolled_list_emplace_test() {
+	// the elements are constructed in place from the arguments
+	UnrolledList<std::pair<int, std::string>, 128> l;
+	l.emplace_back(1, "b");
+	l.emplace_front(0, "a").second += "a";
+	auto it = l.emplace(l.end(), 3, "d");
+	l.emplace(it, 2, "c");
+	for (int i = 4; i < 100; ++i) {
+		l.emplace_back(i, std::to_string(i));
+	}
+	return l.size() == 100 && l.front() == std::make_pair(0, std::string("aa")) && l.back().first == 99
+		&& *++l.begin() == std::make_pair(1, std::string("b")) && *++++l.begin() == std::make_pair(2, std::string("c"));
+}
+
+bool experimental_unrolled_list_allocator_propagation_test() {
+	// polymorphic allocators do not propagate: the elements move one by one between unequal resources
+	using PmrList = UnrolledList<std::string, 256, std::pmr::polymorphic_allocator<std::string>>;
+	std::pmr::monotonic_buffer_resource r1, r2;
+	PmrList a(&r1), b(&r2), c(&r1);
+	std::vector<std::string> expected;
+	for (int i = 0; i < 50; ++i) {
+		expected.push_back(std::to_string(i) + " is long enough not to be a small string");
+		a.push_back(expected.back());
+	}
+	b = std::move(a);
+	if (b.get_allocator().resource() != &r2 || !a.empty() || !list_equals(b, expected)) {
+		return false;
+	}
+	c = b;
+	if (c.get_allocator().resource() != &r1 || !list_equals(c, expected) || !list_equals(b, expected)) {
+		return false;
+	}
+	// equal allocators: the blocks are taken over
+	std::string const *front = &c.front();
+	a = std::move(c);
+	if (&a.front() != front || !c.empty()) {
+		return false;
+	}
+	a.swap(c);
+	return a.empty() && &c.front() == front
+		&& !noexcept(std::declval<PmrList &>() = std::declval<PmrList &&>())
+		&& noexcept(std::declval<UnrolledList<int> &>() = std::declval<UnrolledList<int> &&>());
+}
+
+void experimental_unrolled_list_unit_tests() {
+	puts("----------------------------------------------------------");
+	puts("Running UnrolledList Unit Tests...\n");
+
+	_RUN_UNIT_TEST_(experimental_unrolled_list_push_pop_test);
+
+	_RUN_UNIT_TEST_(experimental_unrolled_list_insert_erase_test);
+
+	_RUN_UNIT_TEST_(experimental_unrolled_list_insert_own_element_test);
+
+	_RUN_UNIT_TEST_(experimental_unrolled_list_splice_test);
+
+	_RUN_UNIT_TEST_(experimental_unrolled_list_merge_test);
+
+	_RUN_UNIT_TEST_(experimental_unrolled_list_sort_test);
+
+	_RUN_UNIT_TEST_(experimental_unrolled_list_copy_move_test);
+
+	_RUN_UNIT_TEST_(experimental_unrolled_list_emplace_test);
+
+	_RUN_UNIT_TEST_(experimental_unrolled_list_allocator_propagation_test);
+
+	puts("\nFinished UnrolledList Unit Tests...");
+	puts("----------------------------------------------------------");
+}
@@ -7,9 +7,110 @@
 
 #include "./inc/unit_test.hpp"
 #include "../inc/ds/experimental_vector.hpp"
+#include "../inc/sorts/experimental_insertion_sort.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
 
 using namespace experimental;
 
+namespace {
+	struct Relocatable;
+}
+
+template<>
+struct experimental::is_trivially_relocatable<Relocatable> : std::true_type {};
+
+namespace {
+	// count the constructions and destructions of its objects
+	struct Tracked {
+		static int constructed;
+		static int defaultConstructed;
+		static int destroyed;
+
+		int value;
+
+		Tracked() : value{ 0 } { ++constructed; ++defaultConstructed; }
+		explicit Tracked(int v) : value{ v } { ++constructed; }
+		Tracked(Tracked const &t) : value{ t.value } { ++constructed; }
+		Tracked(Tracked &&t) noexcept : value{ t.value } { ++constructed; }
+		Tracked& operator=(Tracked const &) = default;
+		Tracked& operator=(Tracked &&) = default;
+		~Tracked() { ++destroyed; }
+
+		static void reset() { constructed = defaultConstructed = destroyed = 0; }
+	};
+	int Tracked::constructed = 0;
+	int Tracked::defaultConstructed = 0;
+	int Tracked::destroyed = 0;
+
+	// owns a heap pointer, marked trivially relocatable below
+	struct Relocatable {
+		static int moved;
+
+		int *value;
+
+		explicit Relocatable(int v) : value{ new int(v) } {}
+		Relocatable(Relocatable const &r) : value{ new int(*r.value) } {}
+		Relocatable(Relocatable &&r) noexcept : value{ r.value } { r.value = nullptr; ++moved; }
+		Relocatable& operator=(Relocatable const &) = delete;
+		Relocatable& operator=(Relocatable &&r) noexcept { std::swap(value, r.value); ++moved; return *this; }
+		~Relocatable() { delete value; }
+	};
+	int Relocatable::moved = 0;
+
+	// standard allocator that counts its allocations
+	template<typename T>
+	struct CountingAllocator {
+		using value_type = T;
+
+		static int allocations;
+
+		CountingAllocator() = default;
+		template<typename U>
+		CountingAllocator(CountingAllocator<U> const &) {}
+
+		T* allocate(std::size_t n) { ++allocations; return std::allocator<T>().allocate(n); }
+		void deallocate(T *p, std::size_t n) { std::allocator<T>().deallocate(p, n); }
+
+		friend bool operator==(CountingAllocator const &, CountingAllocator const &) { return true; }
+		friend bool operator!=(CountingAllocator const &, CountingAllocator const &) { return false; }
+	};
+	template<typename T>
+	int CountingAllocator<T>::allocations = 0;
+
+	// throws from its constructors once a countdown reaches 0, counts its live objects
+	struct ThrowingElement {
+		static int live;
+		static int countdown;
+
+		int value;
+
+		ThrowingElement() : value{ 0 } { count(); }
+		ThrowingElement(ThrowingElement const &e) : value{ e.value } { count(); }
+		ThrowingElement& operator=(ThrowingElement const &) = default;
+		~ThrowingElement() { --live; }
+
+		static void count() {
+			if (countdown-- == 0) {
+				throw std::runtime_error("construction failed");
+			}
+			++live;
+		}
+	};
+	int ThrowingElement::live = 0;
+	int ThrowingElement::countdown = -1;
+
+	// has no default constructor
+	struct NoDefault {
+		explicit NoDefault(int v) : value{ v } {}
+		int value;
+	};
+}
+
 bool experimental_vector_copy_constructor() {
 	Vector<int> v1{ 1,2,3 };
 	Vector<int> v2 = v1;
@@ -108,6 +209,305 @@ bool experimental_vector_boolean_iterator_test() {
 	return it3 > it0 && it0 < it3 && (it3 - 3) == it0;
 }
 
+bool experimental_vector_uninitialized_storage_test() {
+	Tracked::reset();
+	{
+		Vector<Tracked> v;
+		v.reserve(100);
+		if (Tracked::constructed != 0) {
+			return false;
+		}
+		for (int i = 0; i < 100; ++i) {
+			v.push_back(Tracked{ i });
+		}
+		v.pop_back();
+		v.resize(50);
+		if (Tracked::defaultConstructed != 0 || v.size() != 50 || v.back().value != 49) {
+			return false;
+		}
+		v.resize(60); // 10 value-initialized elements
+		if (Tracked::defaultConstructed != 10 || v.back().value != 0) {
+			return false;
+		}
+		v.clear();
+	}
+	// every constructed element is destroyed exactly once
+	return Tracked::constructed == Tracked::destroyed;
+}
+
+bool experimental_vector_no_default_constructor_test() {
+	Vector<NoDefault> v;
+	for (int i = 0; i < 100; ++i) {
+		v.push_back(NoDefault{ i });
+	}
+	// push back an element of the vector itself while it grows
+	Vector<std::string> vs;
+	vs.push_back("first");
+	for (int i = 0; i < 10; ++i) {
+		vs.push_back(vs.front());
+	}
+	Vector<NoDefault> cpy = v;
+	cpy = v;
+	return v.size() == 100 && v[99].value == 99 && cpy[42].value == 42 && vs.size() == 11 && vs.back() == "first";
+}
+
+bool experimental_vector_insert_erase_test() {
+	// trivially copyable elements: memmove/memcpy path
+	Vector<int> vi{ 1,5 };
+	int arr[] = { 2,3,4 };
+	vi.insert(vi.begin() + 1, arr, arr + 3);			// 1 2 3 4 5
+	vi.insert(vi.end(), 2, 6);						// 1 2 3 4 5 6 6
+	vi.emplace(vi.begin(), 0);						// 0 1 2 3 4 5 6 6
+	vi.erase(vi.begin() + 1, vi.begin() + 3);			// 0 3 4 5 6 6
+	vi.erase(vi.end() - 1);							// 0 3 4 5 6
+	int expectedInts[] = { 0,3,4,5,6 };
+	if (vi.size() != 5) {
+		return false;
+	}
+	for (int i = 0; i < 5; ++i) {
+		if (vi[i] != expectedInts[i]) {
+			return false;
+		}
+	}
+
+	// non-trivial elements: construct and rotate path
+	Vector<std::string> vs;
+	vs.reserve(10);
+	vs.emplace_back(3, 'c');
+	vs.emplace(vs.begin(), "a");
+	vs.insert(vs.begin() + 1, 2, vs.front());		// value from the vector itself
+	Vector<std::string> tail{ "x", "y" };
+	vs.append(tail.begin(), tail.end());
+	vs.erase(vs.begin() + 2);
+	std::string expectedStrings[] = { "a", "a", "ccc", "x", "y" };
+	if (vs.size() != 5) {
+		return false;
+	}
+	for (int i = 0; i < 5; ++i) {
+		if (vs[i] != expectedStrings[i]) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool experimental_vector_range_insert_reallocation_test() {
+	Tracked::reset();
+	{
+		Vector<Tracked> src;
+		for (int i = 0; i < 100; ++i) {
+			src.emplace_back(i);
+		}
+		Vector<Tracked> v;
+		v.emplace_back(-1);
+		v.emplace_back(-2);
+		int before = Tracked::constructed;
+		// one reallocation: 100 copies and 2 relocations
+		v.insert(v.begin() + 1, src.begin(), src.end());
+		if (Tracked::constructed - before != 102 || v.size() != 102
+			|| v[0].value != -1 || v[1].value != 0 || v[100].value != 99 || v[101].value != -2) {
+			return false;
+		}
+		v.assign(3, v[5]);
+		if (v.size() != 3 || v[0].value != 4 || v[2].value != 4) {
+			return false;
+		}
+		v.assign({ Tracked{ 7 } });
+		if (v.size() != 1 || v[0].value != 7) {
+			return false;
+		}
+	}
+	return Tracked::constructed == Tracked::destroyed;
+}
+
+bool experimental_vector_exception_safety_test() {
+	// each throws on its fourth construction, and must not leave any element behind
+	ThrowingElement::countdown = 3;
+	try {
+		Vector<ThrowingElement> v(10);
+		return false;
+	}
+	catch (std::runtime_error const &) {}
+	if (ThrowingElement::live != 0) {
+		return false;
+	}
+
+	{
+		Vector<ThrowingElement> v(5);
+		v.reserve(20);
+		ThrowingElement::countdown = 3;
+		try {
+			Vector<ThrowingElement> cpy = v;
+			return false;
+		}
+		catch (std::runtime_error const &) {}
+		if (ThrowingElement::live != 5) {
+			return false;
+		}
+		// the gap is filled past the end without reallocation
+		ThrowingElement::countdown = 3;
+		try {
+			v.insert(v.begin() + 1, 8, v.front());
+			return false;
+		}
+		catch (std::runtime_error const &) {}
+		if (v.size() != 5 || ThrowingElement::live != 5) {
+			return false;
+		}
+		// the gap is filled in new storage
+		ThrowingElement::countdown = 3;
+		try {
+			v.insert(v.begin() + 1, 30, v.front());
+			return false;
+		}
+		catch (std::runtime_error const &) {}
+		if (v.size() != 5 || ThrowingElement::live != 5) {
+			return false;
+		}
+		ThrowingElement::countdown = -1;
+	}
+	return ThrowingElement::live == 0;
+}
+
+bool experimental_vector_trivially_relocatable_test() {
+	Relocatable::moved = 0;
+	Vector<Relocatable> v;
+	for (int i = 0; i < 1000; ++i) {
+		v.emplace_back(i);
+	}
+	v.push_back(v.front());					// grows while copying an element of itself
+	v.emplace(v.begin() + 1, -1);
+	v.erase(v.begin() + 2, v.begin() + 4);	// removes 1 and 2
+	v.reserve(5000);
+	// growth, insertion and erasure relocate with memcpy/memmove: no move constructor call
+	if (Relocatable::moved != 0 || v.size() != 1000) {
+		return false;
+	}
+
+	Vector<long long> vl;
+	for (long long i = 0; i < 100000; ++i) {
+		vl.push_back(i);
+	}
+	Vector<long long> cpy = vl;
+	Vector<long long> assigned{ 1,2,3 };
+	assigned = cpy;
+	return *v[0].value == 0 && *v[1].value == -1 && *v[2].value == 3 && *v.back().value == 0
+		&& assigned.size() == 100000 && assigned[99999] == 99999 && cpy[12345] == 12345;
+}
+
+bool experimental_vector_allocator_test() {
+	// allocator without reallocate(): growth allocates, copies and releases
+	Vector<int, CountingAllocator<int>> vc;
+	for (int i = 0; i < 100; ++i) {
+		vc.push_back(i);
+	}
+	if (CountingAllocator<int>::allocations == 0 || vc[99] != 99) {
+		return false;
+	}
+
+	// polymorphic allocator: the strings use the resource of the vector too
+	char buffer[4096];
+	std::pmr::monotonic_buffer_resource resource(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+	pmr::Vector<std::pmr::string> vs{ &resource };
+	vs.reserve(4);
+	vs.emplace_back("pmr");
+	vs.emplace_back(vs.front());
+	if (vs.get_allocator().resource() != &resource || vs[1].get_allocator().resource() != &resource) {
+		return false;
+	}
+
+	// huge pages: 8 MB grown with mremap
+	Vector<long long, HugePageAllocator<long long>> vh;
+	for (long long i = 0; i < (1 << 20); ++i) {
+		vh.push_back(i);
+	}
+	Vector<long long, HugePageAllocator<long long>> vhCpy = vh;
+
+	// NUMA node of the calling thread
+	Vector<int, NumaAllocator<int>> vn{ NumaAllocator<int>(NumaAllocator<int>::current_node()) };
+	vn.resize(100000);
+	vn[99999] = 1;
+	Vector<int, NumaAllocator<int>> vnOther{ NumaAllocator<int>(NumaAllocator<int>::current_node() + 1) };
+	vnOther = vn;
+	return vs[1] == "pmr" && vh[(1 << 20) - 1] == (1 << 20) - 1 && vhCpy[12345] == 12345
+		&& vn[99999] == 1 && vnOther[99999] == 1 && vnOther.get_allocator() == vn.get_allocator();
+}
+
+bool experimental_vector_growth_policy_test() {
+	// resizing an empty vector allocates the exact size
+	Vector<int> v;
+	v.resize(1000);
+	if (v.capacity() != 1000) {
+		return false;
+	}
+
+	Vector<int, Allocator<int>, ExactGrowth> exact;
+	Vector<int, Allocator<int>, DoublingGrowth> doubling;
+	for (int i = 0; i < 100; ++i) {
+		exact.push_back(i);
+		doubling.push_back(i);
+		if (exact.capacity() != exact.size()) {
+			return false;
+		}
+	}
+	// 1, 3, 7, 15, 31, 63, 127
+	if (doubling.capacity() != 127) {
+		return false;
+	}
+
+	// large blocks fill whole pages
+	Vector<char, Allocator<char>, PageRoundedGrowth<>> paged;
+	paged.resize(1000000);
+	return paged.capacity() % details::page_size() == 0 && paged.capacity() >= 1000000;
+}
+
+bool experimental_vector_shrink_to_fit_test() {
+	Vector<std::string> vs;
+	for (int i = 0; i < 100; ++i) {
+		vs.push_back(std::to_string(i));
+	}
+	vs.erase(vs.begin() + 10, vs.end());
+	vs.shrink_to_fit();
+	if (vs.capacity() != 10 || vs[9] != "9") {
+		return false;
+	}
+
+	Vector<int> vi(1000);
+	vi.resize(10);
+	vi.shrink_to_fit();		// realloc in place
+	if (vi.capacity() != 10) {
+		return false;
+	}
+	vi.clear();
+	vi.shrink_to_fit();
+	return vi.capacity() == 0 && vs.size() == 10;
+}
+
+bool experimental_vector_iterator_mode_test() {
+#if _EXPERIMENTAL_VECTOR_CHECKED_ITERATORS_
+	static_assert(sizeof(Vector<int>::iterator) == 2 * sizeof(int *), "checked iterators hold the vector");
+#else
+	static_assert(sizeof(Vector<int>::iterator) == sizeof(int *), "release iterators hold a pointer only");
+#endif
+#ifdef __cpp_lib_concepts
+	static_assert(std::contiguous_iterator<Vector<int>::iterator>);
+	static_assert(std::contiguous_iterator<Vector<int>::const_iterator>);
+#endif
+	static_assert(std::is_same<std::iterator_traits<Vector<int>::iterator>::iterator_category,
+							   std::random_access_iterator_tag>::value, "");
+
+	Vector<int> v{ 5,3,9,1,7,2,8 };
+	insertion_sort(v.begin(), v.end());
+	if (!std::is_sorted(v.begin(), v.end())) {
+		return false;
+	}
+	std::sort(v.begin(), v.end(), std::greater<int>());
+	Vector<int>::iterator it{};
+	it = v.begin();
+	Vector<int>::const_iterator cit = it + 2;
+	return v[0] == 9 && it[6] == 1 && *(2 + it) == 7 && cit - v.cbegin() == 2 && &*cit == v.data() + 2;
+}
+
 void experimental_vector_unit_tests() {
 	puts("----------------------------------------------------------");
 	puts("Running Vector Unit Tests...\n");
@@ -134,6 +534,26 @@ void experimental_vector_unit_tests() {
 
 	_RUN_UNIT_TEST_(experimental_vector_boolean_iterator_test);
 
+	_RUN_UNIT_TEST_(experimental_vector_uninitialized_storage_test);
+
+	_RUN_UNIT_TEST_(experimental_vector_no_default_constructor_test);
+
+	_RUN_UNIT_TEST_(experimental_vector_insert_erase_test);
+
+	_RUN_UNIT_TEST_(experimental_vector_range_insert_reallocation_test);
+
+	_RUN_UNIT_TEST_(experimental_vector_exception_safety_test);
+
+	_RUN_UNIT_TEST_(experimental_vector_trivially_relocatable_test);
+
+	_RUN_UNIT_TEST_(experimental_vector_allocator_test);
+
+	_RUN_UNIT_TEST_(experimental_vector_growth_policy_test);
+
+	_RUN_UNIT_TEST_(experimental_vector_shrink_to_fit_test);
+
+	_RUN_UNIT_TEST_(experimental_vector_iterator_mode_test);
+
 	puts("\nFinished Vector Unit Tests...");
 	puts("----------------------------------------------------------");
 }
\ No newline at end of file
@@ -18,10 +18,20 @@ using namespace std::string_literals;
 #define _RUN_UNIT_TEST_(X) (std::cout << ((X() ? (#X + " passed"s) : (#X + " failed"s))) + '\n');
 
 void experimental_vector_unit_tests();
+void experimental_small_vector_unit_tests();
+void experimental_mmap_vector_unit_tests();
+void experimental_segmented_vector_unit_tests();
 void experimental_sorting_algorithms_unit_tests();
+void experimental_simd_algorithms_unit_tests();
 void experimental_stack_unit_test();
 void experimental_list_unit_tests();
+void experimental_unrolled_list_unit_tests();
+void experimental_intrusive_list_unit_tests();
+void experimental_mpmc_queue_unit_tests();
+void experimental_spsc_queue_unit_tests();
+void experimental_concurrent_stack_unit_tests();
 void experimental_BST_unit_tests();
 void experimental_AVL_unit_tests();
+void experimental_concurrent_skip_list_unit_tests();
 
 #endif // !_UNIT_TEST_HPP_